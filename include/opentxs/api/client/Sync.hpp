@@ -44,11 +44,16 @@
 #include "opentxs/Types.hpp"
 
 #include <cstdint>
+#include <functional>
 
 #define DEFAULT_PROCESS_INBOX_ITEMS 5
 
 namespace opentxs
 {
+/** Receives the task ID and final status of a scheduled task */
+typedef std::function<void(const Identifier&, const ThreadStatus)>
+    TaskCallback;
+
 namespace api
 {
 namespace client
@@ -114,9 +119,20 @@ public:
     EXPORT virtual Identifier ScheduleRegisterNym(
         const Identifier& localNymID,
         const Identifier& serverID) const = 0;
+    /** Invokes callback once, from a background thread, when the task
+     *  finishes. If the task has already finished the callback is invoked
+     *  immediately. A task reported through a callback is no longer reported
+     *  by Status(). */
+    EXPORT virtual void SetTaskCallback(
+        const Identifier& taskID,
+        const TaskCallback& callback) const = 0;
     EXPORT virtual void StartIntroductionServer(
         const Identifier& localNymID) const = 0;
     EXPORT virtual ThreadStatus Status(const Identifier& thread) const = 0;
+    /** Blocks until RefreshCount() no longer equals previous, or until the
+     *  api is shutting down. Returns the current refresh count. */
+    EXPORT virtual std::uint64_t WaitForRefresh(
+        const std::uint64_t previous) const = 0;
 
     EXPORT virtual ~Sync() = default;
 
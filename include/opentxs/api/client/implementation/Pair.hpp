@@ -49,6 +49,7 @@
 #include <memory>
 #include <thread>
 #include <tuple>
+#include <vector>
 
 namespace opentxs
 {
@@ -201,8 +201,14 @@ private:
 
     Native& ot_;
     mutable NymMap nym_map_;
+    // Revision at which each cached nym last passed VerifyPseudonym
+    mutable std::map<std::string, std::uint64_t> nym_verified_;
     mutable ServerMap server_map_;
+    // Digest of the serialized contract each cached server contract or unit
+    // definition last passed Validate() with
+    mutable std::map<std::string, Identifier> server_verified_;
     mutable UnitMap unit_map_;
+    mutable std::map<std::string, Identifier> unit_verified_;
     mutable ContextMap context_map_;
     mutable IssuerMap issuer_map_;
     mutable std::mutex nym_map_lock_;
@@ -215,6 +221,9 @@ private:
     mutable std::mutex nymfile_map_lock_;
     mutable std::map<Identifier, std::mutex> nymfile_lock_;
 
+    static Identifier digest(const proto::ServerContract& contract);
+    static Identifier digest(const proto::UnitDefinition& contract);
+
     std::mutex& nymfile_lock(const Identifier& nymID) const;
     std::mutex& peer_lock(const std::string& nymID) const;
     void save(class Context* context) const;
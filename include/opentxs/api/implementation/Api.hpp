@@ -92,6 +92,7 @@ private:
 
     void Cleanup();
     void Init();
+    void Start();
 
     Api(const std::atomic<bool>& shutdown,
         const api::Activity& activity,
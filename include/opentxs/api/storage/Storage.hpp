@@ -66,6 +66,9 @@ namespace storage
 class Storage
 {
 public:
+    /** Defers the index and root updates of this thread's writes until the
+     *  matching CommitBatch. Batches may be nested. */
+    virtual void BeginBatch() const = 0;
     virtual std::set<std::string> BlockchainAccountList(
         const std::string& nymID,
         const proto::ContactItemType type) const = 0;
@@ -73,6 +76,8 @@ public:
         proto::ContactItemType chain,
         std::string address) const = 0;
     virtual ObjectList BlockchainTransactionList() const = 0;
+    /** Writes every index touched since BeginBatch once, then the root */
+    virtual bool CommitBatch() const = 0;
     virtual std::string ContactAlias(const std::string& id) const = 0;
     virtual ObjectList ContactList() const = 0;
     virtual ObjectList ContextList(const std::string& nymID) const = 0;
@@ -271,6 +276,9 @@ public:
     virtual bool Store(
         const proto::UnitDefinition& data,
         const std::string& alias = std::string("")) const = 0;
+    virtual bool ThreadExists(
+        const std::string& nymID,
+        const std::string& threadID) const = 0;
     virtual ObjectList ThreadList(
         const std::string& nymID,
         const bool unreadOnly) const = 0;
@@ -279,6 +287,7 @@ public:
         const std::string& threadID) const = 0;
     virtual std::string UnitDefinitionAlias(const std::string& id) const = 0;
     virtual ObjectList UnitDefinitionList() const = 0;
+    virtual std::size_t UnreadCount(const std::string& nymId) const = 0;
     virtual std::size_t UnreadCount(
         const std::string& nymId,
         const std::string& threadId) const = 0;
@@ -294,6 +303,29 @@ private:
     Storage& operator=(const Storage&) = delete;
     Storage& operator=(Storage&&) = delete;
 };
+
+/** Holds a batch open for its lifetime, so the batch is committed even if
+ *  the caller leaves early or throws */
+class Batch
+{
+public:
+    explicit Batch(const Storage& storage)
+        : storage_(storage)
+    {
+        storage_.BeginBatch();
+    }
+
+    ~Batch() { storage_.CommitBatch(); }
+
+private:
+    const Storage& storage_;
+
+    Batch() = delete;
+    Batch(const Batch&) = delete;
+    Batch(Batch&&) = delete;
+    Batch& operator=(const Batch&) = delete;
+    Batch& operator=(Batch&&) = delete;
+};
 }  // namespace storage
 }  // namespace api
 }  // namespace opentxs
@@ -88,6 +88,7 @@ namespace implementation
 class Storage : public opentxs::api::storage::Storage
 {
 public:
+    void BeginBatch() const override;
     std::set<std::string> BlockchainAccountList(
         const std::string& nymID,
         const proto::ContactItemType type) const override;
@@ -95,6 +96,7 @@ public:
         proto::ContactItemType chain,
         std::string address) const override;
     ObjectList BlockchainTransactionList() const override;
+    bool CommitBatch() const override;
     std::string ContactAlias(const std::string& id) const override;
     ObjectList ContactList() const override;
     ObjectList ContextList(const std::string& nymID) const override;
@@ -289,6 +291,8 @@ public:
     bool Store(
         const proto::UnitDefinition& data,
         const std::string& alias = std::string("")) const override;
+    bool ThreadExists(const std::string& nymID, const std::string& threadID)
+        const override;
     ObjectList ThreadList(const std::string& nymID, const bool unreadOnly)
         const override;
     std::string ThreadAlias(
@@ -296,6 +300,7 @@ public:
         const std::string& threadID) const override;
     std::string UnitDefinitionAlias(const std::string& id) const override;
     ObjectList UnitDefinitionList() const override;
+    std::size_t UnreadCount(const std::string& nymId) const override;
     std::size_t UnreadCount(
         const std::string& nymId,
         const std::string& threadId) const override;
@@ -134,6 +134,13 @@ protected:
         0};  // The tokens in the purse may have different
              // expirations. This stores the earliest one.
     void RecalculateExpirationDates(OTNym_or_SymmetricKey& theOwner);
+    /** Opens a single sealed token. Caller IS responsible to delete. */
+    Token* OpenToken(
+        const OTASCIIArmor& theArmor,
+        OTNym_or_SymmetricKey& theOwner) const;
+    /** Takes ownership of a token that is already sealed to this purse's
+     * owner, without opening or re-sealing it. */
+    void PushSealed(OTASCIIArmor* pArmor, const Token& theToken);
     Purse();  // private
 
 public:
@@ -50,6 +50,7 @@
 #include <stdint.h>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -94,6 +95,14 @@ private:
     const OT_API& ot_api_;
     std::recursive_mutex& lock_;
 
+    static bool valid_nym_type(const proto::ContactItemType type);
+
+    std::string create_nym_hd(
+        const proto::ContactItemType type,
+        const std::string& name,
+        const std::string& fingerprint,
+        const std::uint32_t index) const;
+
     OTAPI_Exec(
         const api::Activity& activity,
         const api::Settings& config,
@@ -529,6 +538,25 @@ public:
         const std::string& fingerprint = "",
         const std::uint32_t index = 0) const;
 
+    /** Create several nyms using HD key derivation
+     *
+     *  Equivalent to calling CreateNymHD once per name with an index of zero,
+     *  except that the wallet is only saved once at the end. The nyms are
+     *  created one after another because each one takes the next nym index
+     *  from the seed and is added to the wallet under its lock.
+     *
+     *  \param[in] names One nym is created for each name
+     *  \param[in] seed (optional)  Specify a custom HD seed fingerprint. If
+     *                              blank or not found, the default wallet seed
+     *                              will be used.
+     *  \returns nym ids for the new nyms in the same order as names. Entries
+     *           for nyms which could not be created are empty.
+     */
+    EXPORT std::vector<std::string> CreateNymsHD(
+        const proto::ContactItemType type,
+        const std::vector<std::string>& names,
+        const std::string& fingerprint = "") const;
+
     EXPORT std::string GetNym_ActiveCronItemIDs(
         const std::string& NYM_ID,
         const std::string& NOTARY_ID) const;
@@ -981,6 +1009,14 @@ public:
     EXPORT std::string GetAccountWallet_ID(const int32_t& nIndex)
         const;  // returns a string containing the account ID,
                 // based on index.
+    /** Accounts owned by NYM_ID on NOTARY_ID for INSTRUMENT_DEFINITION_ID
+     *
+     *  Empty arguments match any value.
+     */
+    EXPORT std::set<Identifier> GetAccountWallet_List(
+        const std::string& NYM_ID,
+        const std::string& NOTARY_ID,
+        const std::string& INSTRUMENT_DEFINITION_ID) const;
     EXPORT std::string GetAccountWallet_Name(const std::string& ACCOUNT_ID)
         const;  // returns the account name, based
                 // on
@@ -60,7 +60,17 @@ class OTWallet : Lockable
 {
 public:
     EXPORT std::set<AccountInfo> AccountList() const;
+    /** Accounts matching every non-empty filter
+     *
+     *  Uses the ownership indexes, so the cost depends on the number of
+     *  matching accounts rather than the size of the wallet.
+     */
+    EXPORT std::set<Identifier> AccountList(
+        const Identifier& nymID,
+        const Identifier& serverID,
+        const Identifier& unitID) const;
     EXPORT void DisplayStatistics(String& strOutput) const;
+    /** Accounts are indexed in Identifier order, not by their string IDs */
     EXPORT bool GetAccount(
         const std::size_t iIndex,
         Identifier& THE_ID,
@@ -96,7 +106,9 @@ public:
         const OTPassword& oldPassphrase,
         const OTPassword& newPassphrase);
     EXPORT bool ConvertNymToCachedKey(Nym& theNym);
-    EXPORT Nym* CreateNym(const NymParameters& nymParameters);
+    EXPORT Nym* CreateNym(
+        const NymParameters& nymParameters,
+        const bool saveWallet = true);
     // These allow the client application to encrypt its own sensitive data.
     // For example, let's say the client application is storing your Bitmessage
     // username and password in its database. It can't store those in the clear,
@@ -193,6 +205,7 @@ private:
     using AccountEntry = std::
         tuple<Identifier, Identifier, Identifier, std::unique_ptr<Account>>;
     using mapOfAccounts = std::map<Identifier, AccountEntry>;
+    using mapOfAccountIndex = std::map<Identifier, std::set<Identifier>>;
     using mapOfSymmetricKeys =
         std::map<std::string, std::shared_ptr<OTSymmetricKey>>;
     using setOfIdentifiers = std::set<Identifier>;
@@ -210,6 +223,11 @@ private:
     String m_strDataFolder{};
     mapOfNymsSP m_mapPrivateNyms{};
     mapOfAccounts m_mapAccounts;
+    // Secondary indexes over m_mapAccounts, kept in step by add_account and
+    // RemoveAccount
+    mapOfAccountIndex m_mapAccountsByNym{};
+    mapOfAccountIndex m_mapAccountsByServer{};
+    mapOfAccountIndex m_mapAccountsByUnit{};
     // Let's say you have some private data that you want to store safely.
     // For example, your Bitmessage user/pass. Perhaps you want to throw
     // your Bitmessage connect string into your client-side sql*lite DB.
@@ -240,6 +258,10 @@ private:
     // to see which ones are converted already.)
     setOfIdentifiers m_setNymsOnCachedKey{};
 
+    const std::set<Identifier>& accounts_by(
+        const Lock& lock,
+        const mapOfAccountIndex& index,
+        const Identifier& id) const;
     void add_account(const Lock& lock, const Account& theAcct);
     bool add_extra_key(
         const Lock& lock,
@@ -248,6 +270,10 @@ private:
     void add_nym(const Lock& lock, const Nym& theNym, mapOfNymsSP& map);
     bool convert_nym_to_cached_key(const Lock& lock, Nym& theNym);
     Account* get_account(const Lock& lock, const Identifier& theAccountID);
+    void index_account(
+        const Lock& lock,
+        const Identifier& accountID,
+        const AccountEntry& entry);
     Nym* get_private_nym_by_id(const Lock& lock, const Identifier& NYM_ID);
     Account* load_account(
         const Lock& lock,
@@ -264,6 +290,10 @@ private:
     void release(const Lock& lock);
     bool save_contract(const Lock& lock, String& strContract);
     bool save_wallet(const Lock& lock, const char* szFilename = nullptr);
+    void unindex_account(
+        const Lock& lock,
+        const Identifier& accountID,
+        const AccountEntry& entry);
     bool verify_account(
         const Lock& lock,
         const Nym& theNym,
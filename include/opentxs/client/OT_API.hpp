@@ -52,6 +52,7 @@
 #include "opentxs/Types.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -105,6 +106,14 @@ public:
     EXPORT std::int32_t GetNymCount() const;
     EXPORT std::set<Identifier> LocalNymList() const;
     EXPORT std::set<AccountInfo> Accounts() const;
+    /** Accounts owned by nymID on serverID denominated in unitID
+     *
+     *  Empty filters match any value.
+     */
+    EXPORT std::set<Identifier> Accounts(
+        const Identifier& nymID,
+        const Identifier& serverID,
+        const Identifier& unitID) const;
     EXPORT std::int32_t GetAccountCount() const;
 
     EXPORT bool GetNym(
@@ -220,7 +229,11 @@ public:
     /// Returns a new nym (with key pair) and files created.
     /// (Or nullptr.)
     /// Adds to wallet. (No need to delete.)
-    EXPORT Nym* CreateNym(const NymParameters& nymParameters) const;
+    /// Pass saveWallet = false when creating several nyms in a row and save
+    /// the wallet once afterwards.
+    EXPORT Nym* CreateNym(
+        const NymParameters& nymParameters,
+        const bool saveWallet = true) const;
 
     // This works by checking to see if the Nym has a request number for the
     // given server.
@@ -669,6 +682,18 @@ public:
         const Identifier& theAcctID,
         Ledger& responseLedger) const;
 
+    // Accepts every receipt at the given inbox indices (or the whole inbox,
+    // if indices is empty) for which filter returns true, and finalizes the
+    // response with its balance agreement. The inbox and server context are
+    // loaded once for the whole batch. If no receipt was accepted, the
+    // returned processInbox ledger is empty and has not been finalized.
+    EXPORT ProcessInbox Ledger_AcceptReceipts(
+        const Identifier& theNotaryID,
+        const Identifier& theNymID,
+        const Identifier& theAcctID,
+        const std::set<std::int32_t>& indices,
+        const std::function<bool(const OTTransaction&)>& filter = {}) const;
+
     EXPORT OTTransaction* Ledger_GetTransactionByIndex(
         Ledger& theLedger,
         const std::int32_t& nIndex) const;
@@ -52,6 +52,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -567,6 +568,22 @@ public:
         const std::string& seed,
         const std::uint32_t index);
 
+    /** Create several individual nyms using HD key derivation.
+     *
+     *  Equivalent to calling CreateIndividualNym once per name with an index
+     *  of zero, except that the wallet is only saved once at the end.
+     *
+     *  \param[in] names    One nym is created for each name
+     *  \param[in] seed     Specify a custom HD seed fingerprint. If
+     *                      blank or not found, the default wallet seed
+     *                      will be used.
+     *  \returns nym ids for the new nyms in the same order as names. Entries
+     *           for nyms which could not be created are empty.
+     */
+    EXPORT static std::vector<std::string> CreateIndividualNyms(
+        const std::vector<std::string>& names,
+        const std::string& seed);
+
     EXPORT static std::string GetNym_ActiveCronItemIDs(
         const std::string& NYM_ID,
         const std::string& NOTARY_ID);
@@ -849,6 +866,13 @@ public:
     EXPORT static std::string GetAccountWallet_ID(
         const int32_t& nIndex);  // returns a string containing the account ID,
                                  // based on index.
+    /** Comma-separated IDs of the accounts owned by NYM_ID on NOTARY_ID for
+     *  INSTRUMENT_DEFINITION_ID. Empty arguments match any value.
+     */
+    EXPORT static std::string GetAccountWallet_List(
+        const std::string& NYM_ID,
+        const std::string& NOTARY_ID,
+        const std::string& INSTRUMENT_DEFINITION_ID);
     EXPORT static std::string GetAccountWallet_Name(
         const std::string& ACCOUNT_ID);  // returns the account name, based on
                                          // account ID.
@@ -153,8 +153,13 @@ private:
     typedef Signable ot_super;
 
     const std::uint32_t target_version_{0};
+    // Number of editors open on this context. Changes are signed and saved
+    // once, when the last of them closes.
+    std::size_t open_editors_{0};
 
+    void begin_edit();
     proto::Context contract(const Lock& lock) const;
+    bool end_edit(const Lock& lock);
     proto::Context IDVersion(const Lock& lock) const;
     void save(class Nym* nym, const Lock& lock) const;
     proto::Context SigVersion(const Lock& lock) const;
@@ -42,11 +42,16 @@
 #include "opentxs/Forward.hpp"
 
 #include "opentxs/consensus/Context.hpp"
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <tuple>
 
@@ -82,6 +87,10 @@ public:
         ManagedNumber& operator=(ManagedNumber&&) = delete;
     };
 
+    /** Authenticate eligible requests with the MAC of a session negotiated
+     *  with the server instead of signing each one */
+    static void SetSessions(const bool enabled);
+
     ServerContext(
         const ConstNym& local,
         const ConstNym& remote,
@@ -150,6 +159,9 @@ public:
         std::set<TransactionNumber>& bad);
     RequestNumber UpdateRequestNumber();
     RequestNumber UpdateRequestNumber(bool& sendStatus);
+    /** Check the signature or session MAC of a server reply, and complete
+     *  the session handshake if the reply answers one */
+    bool VerifyReply(const Message& reply);
 
     proto::ConsensusType Type() const override;
 
@@ -159,6 +171,7 @@ private:
     typedef Context ot_super;
 
     static const std::string default_node_name_;
+    static std::atomic<bool> sessions_;
 
     ServerConnection& connection_;
     std::mutex message_lock_{};
@@ -168,6 +181,12 @@ private:
     std::atomic<std::uint64_t> revision_{0};
     std::atomic<TransactionNumber> highest_transaction_number_{0};
     std::set<TransactionNumber> tentative_transaction_numbers_{};
+    mutable std::mutex session_lock_{};
+    mutable std::unique_ptr<OTPassword> session_private_{nullptr};
+    mutable OTData session_public_;
+    std::unique_ptr<OTPassword> session_request_key_{nullptr};
+    std::unique_ptr<OTPassword> session_reply_key_{nullptr};
+    String session_id_{};
 
     static void scan_number_set(
         const std::set<TransactionNumber>& input,
@@ -179,6 +198,7 @@ private:
         std::set<TransactionNumber>& good,
         std::set<TransactionNumber>& bad);
 
+    bool establish_session(const Lock& lock, const Message& reply);
     bool finalize_server_command(Message& command) const;
     std::unique_ptr<TransactionStatement> generate_statement(
         const Lock& lock,
@@ -195,6 +215,7 @@ private:
         const bool withNymboxHash);
     using ot_super::serialize;
     proto::Context serialize(const Lock& lock) const override;
+    bool sign_server_command(Message& command) const;
 
     using ot_super::remove_acknowledged_number;
     bool remove_acknowledged_number(const Lock& lock, const Message& reply);
@@ -67,6 +67,8 @@ private:
         const proto::ContactItemType type,
         const proto::HDPath& path);
 
+    int compare(const Identifier& rhs) const;
+
 public:
     EXPORT friend std::ostream& operator<<(std::ostream& os, const String& obj);
     EXPORT static bool validateID(const std::string& strPurportedID);
@@ -91,6 +93,13 @@ public:
     EXPORT bool operator==(const Identifier& s2) const;
     using ot_super::operator!=;
     EXPORT bool operator!=(const Identifier& s2) const;
+    /** Identifiers are ordered by hash type, then by the binary digest
+     *
+     *  This is not the order of their base58 string forms. Containers keyed
+     *  by Identifier, and anything which enumerates them by index, list their
+     *  entries in this order. Empty identifiers sort first and are equal to
+     *  each other regardless of type.
+     */
     EXPORT bool operator>(const Identifier& s2) const;
     EXPORT bool operator<(const Identifier& s2) const;
     EXPORT bool operator<=(const Identifier& s2) const;
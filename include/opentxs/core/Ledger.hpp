@@ -48,6 +48,7 @@
 #include <cstdint>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace opentxs
 {
@@ -83,6 +84,21 @@ private:  // Private prevents erroneous use by other classes.
 private:
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
+    // Sum of the digests of the abbreviated receipts in m_mapTransactions,
+    // kept current as they enter and leave the box (see accumulate_receipt).
+    std::vector<std::uint8_t> receipt_accumulator_;
+    // Receipts held in full can still change before they are saved, so they
+    // are only digested when the box hash is calculated.
+    std::set<std::int64_t> full_receipts_;
+
+    static void accumulate_receipt(
+        std::vector<std::uint8_t>& accumulator,
+        const OTTransaction& receipt,
+        const bool add);
+
+    bool calculate_box_hash(Identifier& theOutput) const;
+    void track_receipt(const OTTransaction& receipt);
+    void untrack_receipt(const OTTransaction& receipt);
 
 protected:
     // return -1 if error, 0 if nothing, and 1 if the node was processed.
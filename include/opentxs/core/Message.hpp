@@ -48,6 +48,7 @@
 
 #include <stdint.h>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -58,6 +59,7 @@ namespace opentxs
 class Context;
 class Message;
 class Nym;
+class OTPassword;
 class OTPasswordData;
 class ServerContext;
 class Tag;
@@ -108,6 +110,7 @@ private:
     static const TypeMap message_names_;
     static const ReverseTypeMap message_types_;
     static const std::map<MessageType, MessageType> reply_message_;
+    static const std::set<MessageType> session_types_;
 
     static ReverseTypeMap make_reverse_map();
     static MessageType reply_command(const MessageType& type);
@@ -126,6 +129,21 @@ public:
     EXPORT static std::string Command(const MessageType type);
     EXPORT static MessageType Type(const std::string& type);
     EXPORT static std::string ReplyCommand(const MessageType type);
+    /** Derive the id of an authenticated session, and its MAC keys for
+     *  requests (client to server) and replies (server to client), from the
+     *  local ephemeral private key and both ephemeral public keys */
+    EXPORT static bool DeriveSessionKey(
+        const OTPassword& privateKey,
+        const Data& remoteKey,
+        const Data& clientKey,
+        const Data& serverKey,
+        OTPassword& requestKey,
+        OTPassword& replyKey,
+        String& id);
+    /** Messages which may carry a session MAC instead of a signature. Anything
+     *  which carries a transaction or a balance agreement, or which either
+     *  side keeps as a receipt, is always signed. */
+    EXPORT static bool SessionEligible(const MessageType type);
 
     EXPORT Message();
     EXPORT virtual ~Message();
@@ -138,6 +156,8 @@ public:
     EXPORT bool VerifySignature(
         const Nym& theNym,
         const OTPasswordData* pPWData = nullptr) const override;
+    EXPORT bool SignSession(const String& id, const OTPassword& key);
+    EXPORT bool VerifySession(const String& id, const OTPassword& key) const;
 
     EXPORT bool HarvestTransactionNumbers(
         ServerContext& context,
@@ -191,6 +211,10 @@ public:
     // it can be put here in ascii-armored format.
     OTASCIIArmor m_ascPayload2;  // Sometimes one payload just isn't enough.
     OTASCIIArmor m_ascPayload3;  // Sometimes two payload just isn't enough.
+    OTASCIIArmor m_ascSessionKey;  // Session handshake: the sender's
+                                   // ephemeral public key.
+    String m_strSessionID;  // Set when the message is authenticated by the
+                            // MAC of this session instead of a signature.
 
     // This list of request numbers is stored for optimization, so client/server
     // can communicate about
@@ -116,7 +116,7 @@ public:
     // Outpayments.
     // (Payments screen.)
     // A payments message is the original OTMessage that this Nym sent.
-    EXPORT void AddOutpayments(Message& theMessage);
+    EXPORT bool AddOutpayments(Message& theMessage);
     EXPORT std::string Alias() const;
     EXPORT const serializedCredentialIndex asPublicNym() const;
     EXPORT std::shared_ptr<const proto::Credential> ChildCredentialContents(
@@ -313,7 +313,7 @@ public:
     EXPORT explicit Nym(const NymParameters& nymParameters);
     EXPORT explicit Nym(const Identifier& nymID);
     EXPORT explicit Nym(const String& strNymID);
-    EXPORT Nym(const Nym&) = default;
+    EXPORT Nym(const Nym&) = delete;
     EXPORT ~Nym();
 
     template <class T>
@@ -386,20 +386,36 @@ private:
     // downloading account, can compare ITS outbox hash to this one, to see if I
     // already have latest one.)
     mapOfIdentifiers m_mapOutboxHash{};
+    // An outgoing payment. The nymfile only records its storage key and
+    // transaction numbers; the message itself is stored on its own under
+    // OTFolders::Outpayments() and loaded when first accessed. An empty key
+    // means the message could not be stored, and is kept in the nymfile.
+    struct Outpayment {
+        std::string key_{};
+        std::set<std::int64_t> numbers_{};
+        mutable std::unique_ptr<Message> message_{nullptr};
+    };
+
     // Any outoing payments sent by this Nym. (And not yet deleted.) (payments
     // screen.)
-    dequeOfMail m_dequeOutpayments{};
+    std::deque<Outpayment> m_dequeOutpayments{};
+    // Keys of removed outpayments. The stored messages are erased once a
+    // nymfile which no longer refers to them has been saved.
+    std::set<std::string> m_setRemovedOutpayments{};
     // (SERVER side)
     // A list of asset account IDs. Server side only (client side uses wallet;
     // has multiple servers.)
     std::set<std::string> m_setAccounts{};
 
+    void erase_outpayments();
     bool GetHash(
         const mapOfIdentifiers& the_map,
         const std::string& str_id,
         Identifier& theOutput) const;
     void init_claims(const Lock& lock) const;
+    Message* load_outpayment(const Outpayment& outpayment) const;
     const CredentialSet* MasterCredential(const String& strID) const;
+    static std::set<std::int64_t> outpayment_numbers(const Message& message);
     bool SaveCredentialIDs() const;
     void SaveCredentialsToTag(
         Tag& parent,
@@ -409,6 +425,7 @@ private:
         const CredentialIndexModeFlag mode = ONLY_IDS) const;
     bool set_contact_data(const Lock& lock, const proto::ContactData& data);
     void SerializeNymIDSource(Tag& parent) const;
+    bool store_outpayment(Outpayment& outpayment) const;
     bool Verify(const Data& plaintext, const proto::Signature& sig) const;
     bool verify_lock(const Lock& lock) const;
 
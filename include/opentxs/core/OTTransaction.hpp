@@ -496,6 +496,10 @@ public:
 
     bool IsAbbreviated() const { return m_bIsAbbreviated; }
 
+    // The hash an abbreviated record stores for this receipt: the stored hash
+    // if this is already abbreviated, otherwise the hash of the full receipt.
+    void CalculateReceiptHash(Identifier& theOutput) const;
+
     int64_t GetAbbrevAdjustment() const { return m_lAbbrevAmount; }
 
     void SetAbbrevAdjustment(int64_t lAmount) { m_lAbbrevAmount = lAmount; }
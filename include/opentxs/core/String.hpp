@@ -169,6 +169,8 @@ public:
     EXPORT bool MemSet(const char* mem, uint32_t size);
     EXPORT void Concatenate(const char* arg, ...) ATTR_PRINTF(2, 3);
     void Concatenate(const String& data);
+    /** Appends data directly, without a printf-style formatting pass. */
+    void Concatenate(const std::string& data);
     void Truncate(uint32_t index);
     EXPORT void Format(const char* fmt, ...) ATTR_PRINTF(2, 3);
     void ConvertToUpperCase() const;
@@ -50,6 +50,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -73,6 +74,18 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const = 0;
+    /** Derive several children of the same parent
+     *
+     *  The path to the parent is only walked once.
+     *
+     *  \returns one key per entry in children, in the same order, or an
+     *           empty vector if any of them could not be derived.
+     */
+    virtual std::vector<serializedAsymmetricKey> GetHDKeys(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        const proto::HDPath& parent,
+        const std::vector<std::uint32_t>& children) const = 0;
 
     serializedAsymmetricKey AccountChildKey(
         const proto::HDPath& path,
@@ -135,6 +135,17 @@ public:
         const OTPassword& seed,
         OTPassword& privateKey,
         Data& publicKey) const;
+    /** Calculate the ECDH shared secret between two keys */
+    virtual bool SharedSecret(
+        const AsymmetricKeyEC& privateKey,
+        const AsymmetricKeyEC& publicKey,
+        const OTPasswordData& password,
+        OTPassword& secret) const;
+    /** Calculate the ECDH shared secret between two raw keys */
+    bool SharedSecret(
+        const Data& publicKey,
+        const OTPassword& privateKey,
+        OTPassword& secret) const;
 
     virtual ~Ecdsa() = default;
 };
@@ -110,14 +110,18 @@ private:
     bool VerifySignedBySelf(const Lock& lock) const;
 
 #if OT_CRYPTO_SUPPORTED_KEY_HD
-    std::shared_ptr<OTKeypair> DeriveHDKeypair(
+    static std::shared_ptr<OTKeypair> HDKeypair(
+        const EcdsaCurve& curve,
+        const proto::KeyRole role,
+        serializedAsymmetricKey privateKey);
+
+    void DeriveHDKeypairs(
         const OTPassword& seed,
         const std::string& fingerprint,
         const uint32_t nym,
         const uint32_t credset,
         const uint32_t credindex,
-        const EcdsaCurve& curve,
-        const proto::KeyRole role);
+        const EcdsaCurve& curve);
 #endif
 
 protected:
@@ -45,6 +45,7 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <cstddef>
 #include <list>
 #include <map>
 #include <string>
@@ -53,6 +54,7 @@ namespace opentxs
 
 {
 class AsymmetricKeyEC;
+class Ecdsa;
 class Nym;
 class OTPasswordData;
 class Data;
@@ -67,11 +69,27 @@ typedef std::multimap<std::string, const AsymmetricKeyEC*> mapOfECKeys;
 class Letter
 {
 private:
+    /** Seal to more recipients than this in parallel */
+    static const std::size_t PARALLEL_RECIPIENTS{4};
+
+    static bool AddECRecipients(
+        const Ecdsa& engine,
+        const AsymmetricKeyEC& dhPrivateKey,
+        const mapOfECKeys& recipients,
+        const proto::SymmetricKey& sessionKey,
+        const proto::SymmetricMode mode,
+        proto::Envelope& envelope);
     static bool AddRSARecipients(
         const mapOfAsymmetricKeys& recipients,
         const SymmetricKey& sessionKey,
         proto::Envelope envelope);
     static bool DefaultPassword(OTPasswordData& password);
+    /** Recipient hint stored in the iv of each encrypted session key
+     *
+     *  Derived from the ECDH secret, so only the intended recipient can
+     *  recognize its own session key and skip trial decryption of the rest.
+     */
+    static bool KeyTag(const OTPassword& secret, std::string& tag);
     static bool SortRecipients(
         const mapOfAsymmetricKeys& recipients,
         mapOfAsymmetricKeys& RSARecipients,
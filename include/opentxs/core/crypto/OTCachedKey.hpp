@@ -46,6 +46,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -230,6 +231,11 @@ private:
 
     mutable std::mutex general_lock_;
     mutable std::mutex master_password_lock_;
+    /** Used by timeout_thread to sleep until the password is due to expire,
+     * rather than polling. Notified whenever the deadline or shutdown_
+     * changes. */
+    mutable std::mutex timer_lock_;
+    mutable std::condition_variable timer_;
     mutable std::atomic<bool> shutdown_{false};
     /** if set to true, then additionally use the local OS's standard API for
      * storing/retrieving secrets. (Store the master key here whenever it's
@@ -254,6 +260,7 @@ private:
     mutable std::unique_ptr<OTSymmetricKey> key_;
     mutable String secret_id_{""};
 
+    void notify_timer() const;
     void release_thread() const;
     /** The cleartext version (m_pMasterPassword) is deleted and set nullptr
      * after a Timer of X seconds. (Timer thread calls this.) The INSTANCE that
@@ -103,7 +103,8 @@ private:
     bool EncryptKey(
         const OTPassword& plaintextKey,
         const OTPasswordData& keyPassword,
-        const proto::SymmetricKeyType type = proto::SKEYTYPE_ARGON2);
+        const proto::SymmetricKeyType type = proto::SKEYTYPE_ARGON2,
+        const std::string& iv = "");
     bool GetPassword(const OTPasswordData& keyPassword, OTPassword& password);
 
     SymmetricKey(const CryptoSymmetricNew& engine);
@@ -175,9 +176,18 @@ public:
         const CryptoSymmetricNew& engine,
         const OTPassword& raw);
 
+    /** Re-encrypt the key to a new password
+     *
+     *  \param[in] oldPassword The password currently protecting the key
+     *  \param[in] newPassword The password which will protect the key
+     *  \param[in] iv Optional iv for the encrypted key. Must not be reused
+     *                with the same new password. If it is shorter than the
+     *                mode requires a random iv is used instead.
+     */
     bool ChangePassword(
         const OTPasswordData& oldPassword,
-        const OTPassword& newPassword);
+        const OTPassword& newPassword,
+        const std::string& iv = "");
 
     /** Decrypt ciphertext using the symmetric key
      *
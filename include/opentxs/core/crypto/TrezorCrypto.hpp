@@ -64,6 +64,7 @@ extern "C" {
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -169,6 +170,11 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const override;
+    std::vector<serializedAsymmetricKey> GetHDKeys(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        const proto::HDPath& parent,
+        const std::vector<std::uint32_t>& children) const override;
     bool RandomKeypair(OTPassword& privateKey, Data& publicKey) const override;
     std::string SeedToFingerprint(
         const EcdsaCurve& curve,
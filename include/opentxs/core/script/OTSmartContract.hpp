@@ -53,8 +53,10 @@
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -127,6 +129,41 @@ private:
     time64_t m_tNextProcessDate{
         0};  // date that it WILL be, in a week. (Or zero.)
 
+    // While clauses are executing, each account and inbox they touch is
+    // loaded and verified once and kept here. Balance changes and new
+    // receipts stay in memory until the clauses finish, and are then signed
+    // and saved together. (See ExecuteClauses.)
+    struct WorkingAccount {
+        std::shared_ptr<Account> account_{nullptr};
+        std::shared_ptr<Ledger> inbox_{nullptr};
+        std::vector<OTTransaction*> receipts_{};
+        bool dirty_{false};
+    };
+
+    bool working_set_active_{false};
+    bool working_cron_dirty_{false};
+    std::map<std::string, WorkingAccount> working_set_{};
+
+    void begin_working_set();
+    void commit_working_set();
+    std::shared_ptr<Account> load_account(
+        const Identifier& accountID,
+        const Identifier& notaryID,
+        const Nym& serverNym);
+    std::shared_ptr<Ledger> load_inbox(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const Identifier& notaryID,
+        const Nym& serverNym);
+    void add_stash_account(const std::shared_ptr<Account>& account);
+    void save_account(Account& account, const Nym& serverNym);
+    void save_inbox(
+        Account& account,
+        Ledger& inbox,
+        OTTransaction& receipt,
+        const Nym& serverNym);
+    void save_cron();
+
     // For moving money from one nym's account to another.
     // it is also nearly identically copied in OTPaymentPlan.
     bool MoveFunds(
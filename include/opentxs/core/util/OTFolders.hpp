@@ -111,6 +111,7 @@ private:
     static String s_strNym;
     static String s_strNymbox;
     static String s_strOutbox;
+    static String s_strOutpayments;
     static String s_strPaymentInbox;
     static String s_strPurse;
     static String s_strReceipt;
@@ -133,6 +134,7 @@ public:
     EXPORT static const String& Nym();
     EXPORT static const String& Nymbox();
     EXPORT static const String& Outbox();
+    EXPORT static const String& Outpayments();
     EXPORT static const String& PaymentInbox();
     EXPORT static const String& Purse();
     EXPORT static const String& Receipt();
@@ -45,6 +45,9 @@
 #include "opentxs/core/String.hpp"
 
 #include <stdint.h>
+#include <mutex>
+#include <set>
+#include <string>
 
 // All directories have a trailing "/" while files do not. <== remember to
 // enforce this!!!
@@ -157,10 +160,14 @@ public:
                                                                    // folder
                                                                    // exists
 
+    // With bUseCache, a folder which this process has already confirmed is
+    // assumed to still exist. Only pass it if the caller checks the result
+    // and rebuilds the path without the cache when it is wrong.
     EXPORT static bool ConfirmCreateFolder(
         const String& strExactPath,
         bool& out_Exists,
-        bool& out_IsNew);
+        bool& out_IsNew,
+        const bool bUseCache = false);
 
     EXPORT static bool ToReal(
         const String& strExactPath,
@@ -196,27 +203,37 @@ public:
 
     EXPORT static bool BuildFolderPath(
         const String& strFolderPath,
-        bool& out_bFolderCreated);  // will build
-                                    // all the
-                                    // folders to
-                                    // a path.
-                                    // Will return
-                                    // false if
-                                    // unable to
-                                    // build path.
+        bool& out_bFolderCreated,
+        const bool bUseCache = false);  // will build
+                                        // all the
+                                        // folders to
+                                        // a path.
+                                        // Will return
+                                        // false if
+                                        // unable to
+                                        // build path.
     EXPORT static bool BuildFilePath(
         const String& strFolderPath,
-        bool& out_bFolderCreated);  // will build
-                                    // all the
-                                    // folders up to
-                                    // the file.
-                                    // Will return
-                                    // false if
-                                    // unable to
-                                    // build path.
+        bool& out_bFolderCreated,
+        const bool bUseCache = false);  // will build
+                                        // all the
+                                        // folders up to
+                                        // the file.
+                                        // Will return
+                                        // false if
+                                        // unable to
+                                        // build path.
 
 private:
+    // Folders (with trailing "/") which ConfirmCreateFolder has seen exist.
+    // They can still be removed afterwards, by another process or by cleanup
+    // in this one, so entries are only trusted when bUseCache is passed.
+    static std::mutex s_folderLock;
+    static std::set<std::string> s_knownFolders;
+
     static void ConfigureDefaultSettings();
+    static bool IsKnownFolder(const std::string& strExactPath);
+    static void RememberFolder(const std::string& strExactPath);
 };  // class OTPaths
 
 }  // namespace opentxs
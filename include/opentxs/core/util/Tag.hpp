@@ -41,6 +41,7 @@
 
 #include "opentxs/Forward.hpp"
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <vector>
@@ -63,6 +64,8 @@ private:
     map_strings attributes_;
     vector_tags tags_;
 
+    std::size_t output_size() const;
+
 public:
     const std::string& name() const { return name_; }
     const std::string& text() const { return text_; }
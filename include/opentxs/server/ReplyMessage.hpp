@@ -42,7 +42,9 @@
 #include "opentxs/Forward.hpp"
 
 #include "opentxs/api/Editor.hpp"
+#include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/Nym.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
 #include <cstdint>
@@ -54,6 +56,7 @@ namespace opentxs
 
 class OTASCIIArmor;
 class ClientContext;
+class Data;
 class Identifier;
 class Message;
 
@@ -83,8 +86,11 @@ public:
         Message& output);
 
     std::set<RequestNumber> Acknowledged() const;
+    const Identifier& AccountID() const;
     bool HaveContext() const;
     const bool& Init() const;
+    const Identifier& InstrumentDefinitionID() const;
+    const Identifier& NymID() const;
     const Message& Original() const;
     const bool& Success() const;
 
@@ -109,6 +115,8 @@ public:
     bool SetPayload2(const String& payload);
     bool SetPayload3(const String& payload);
     void SetRequestNumber(const RequestNumber number);
+    void SetSession(const String& id, const OTPassword& key);
+    void SetSessionKey(const Data& publicKey);
     void SetSuccess(const bool success);
     void SetTargetNym(const String& nymID);
     void SetTransactionNumber(const TransactionNumber& number);
@@ -119,7 +127,13 @@ private:
     const opentxs::api::client::Wallet& wallet_;
     const Nym& signer_;
     const Message& original_;
+    const MessageType type_;
     const Identifier notary_id_;
+    // Identifiers from the request, decoded once per message
+    const Identifier nym_id_;
+    const Identifier purported_notary_id_;
+    const Identifier account_id_;
+    const Identifier unit_id_;
     Message& message_;
     Server& server_;
     Nym nymfile_;
@@ -128,6 +142,8 @@ private:
     bool drop_status_{false};
     std::shared_ptr<const Nym> sender_nym_{nullptr};
     std::unique_ptr<Editor<ClientContext>> context_{nullptr};
+    String session_id_{};
+    std::unique_ptr<OTPassword> session_key_{nullptr};
 
     void attach_request();
     void clear_request();
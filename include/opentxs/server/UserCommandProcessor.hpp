@@ -41,10 +41,18 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
 #include <cstdint>
+#include <ctime>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace opentxs
 {
@@ -124,10 +132,29 @@ private:
         std::size_t counter_{0};
     };
 
+    // Session negotiated with a client nym in a signed handshake. Eligible
+    // requests from that nym may then be MACed with request_key_ instead of
+    // signed, and their replies are MACed with reply_key_.
+    class Session
+    {
+    public:
+        OTData client_key_{Data::Factory()};
+        OTData server_key_{Data::Factory()};
+        OTPassword request_key_{};
+        OTPassword reply_key_{};
+        String id_{};
+        std::time_t opened_{0};
+    };
+    // Sessions are keyed by nym id and session id, so that each device a nym
+    // uses keeps its own session
+    typedef std::pair<std::string, std::string> SessionID;
+
     Server& server_;
     const opentxs::api::Settings& config_;
     const opentxs::api::Server& mint_;
     const opentxs::api::client::Wallet& wallet_;
+    mutable std::mutex session_lock_{};
+    mutable std::map<SessionID, std::shared_ptr<const Session>> sessions_{};
 
     bool add_numbers_to_nymbox(
         const TransactionNumber transactionNumber,
@@ -207,6 +234,7 @@ private:
         const Identifier& serverID,
         const Nym& serverNym,
         const bool verifyAccount) const;
+    void open_session(ReplyMessage& reply) const;
     bool reregister_nym(ReplyMessage& reply) const;
     bool save_box(const Nym& nym, Ledger& box) const;
     bool save_inbox(const Nym& nym, Identifier& hash, Ledger& inbox) const;
@@ -222,6 +250,7 @@ private:
         Ledger& box,
         const Nym& nym,
         const bool full) const;
+    bool verify_session(ReplyMessage& reply) const;
     bool verify_transaction(const OTTransaction* transaction, const Nym& signer)
         const;
 
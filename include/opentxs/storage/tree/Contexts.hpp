@@ -58,7 +58,6 @@ private:
 
     void init(const std::string& hash) override;
     bool save(const std::unique_lock<std::mutex>& lock) const override;
-    proto::StorageNymList serialize() const;
 
     Contexts(
         const opentxs::api::storage::Driver& storage,
@@ -48,9 +48,13 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -86,6 +90,7 @@ protected:
 
         auto& metadata = item_map_[id];
         auto& hash = std::get<0>(metadata);
+        touch(id);
 
         if (!driver_.StoreProto<T>(data, hash, plaintext)) {
             return false;
@@ -95,7 +100,7 @@ protected:
             std::get<1>(metadata) = alias;
         }
 
-        return save(lock);
+        return commit(lock);
     }
 
     template <class T>
@@ -186,6 +191,36 @@ protected:
     }
 
 private:
+    /** An index update which has been deferred until the end of a batch,
+     *  keyed by the node to be updated and the child it is updated from */
+    typedef std::pair<const Node*, const Node*> DeferredKey;
+    struct DeferredUpdate {
+        DeferredKey key_;
+        /** Expire if the node or the child is destroyed before the batch is
+         *  committed, in which case the update is skipped */
+        std::weak_ptr<const bool> node_;
+        std::weak_ptr<const bool> child_;
+        std::function<bool()> update_;
+    };
+    /** Item ids paired with the key which places them in a chunk, sorted by
+     *  key */
+    typedef std::set<std::pair<std::string, std::string>> ChunkIndex;
+
+    static thread_local std::size_t batch_;
+    static thread_local std::vector<DeferredUpdate> deferred_;
+
+    /** Shared with deferred updates so they can detect a destroyed node */
+    const std::shared_ptr<const bool> alive_;
+
+    static std::string chunk_key(const std::string& id);
+
+    void forget_chunks(const std::string& prefix) const;
+    bool is_dirty(const std::string& prefix) const;
+    std::string save_chunk(
+        const std::string& prefix,
+        const proto::StorageHashType type,
+        bool& success) const;
+
     Node() = delete;
     Node(const Node&) = delete;
     Node(Node&&) = delete;
@@ -197,6 +232,9 @@ protected:
     typedef std::unique_lock<std::mutex> Lock;
 
     static const std::string BLANK_HASH;
+    /** Lists longer than this are written as a tree of chunks */
+    static const std::size_t CHUNK_ITEMS;
+    static const std::string CHUNK_ID;
 
     const opentxs::api::storage::Driver& driver_;
 
@@ -206,14 +244,37 @@ protected:
 
     mutable std::mutex write_lock_;
     mutable Index item_map_;
+    /** Hash of each chunk of the current list, keyed by chunk prefix */
+    mutable std::map<std::string, std::string> chunks_;
+    /** Chunk keys of the items changed since the list was last written */
+    mutable std::set<std::string> dirty_;
+    /** Every item of a chunked list by chunk key, kept up to date by touch()
+     *  once built so saves do not hash and sort the whole list */
+    mutable ChunkIndex chunk_index_;
+    mutable bool indexed_{false};
 
     static std::string normalize_hash(const std::string& hash);
 
+    /** If a batch is open, queues parent.save(child, lock, args...) to run
+     *  when it is committed and returns true */
+    template <class Parent, class Child, class... Args>
+    static bool defer_save(Parent& parent, Child* child, Args... args)
+    {
+        return parent.defer(child, [&parent, child, args...]() -> bool {
+            parent.save(child, Lock(parent.write_lock_), args...);
+
+            return true;
+        });
+    }
+
     bool check_hash(const std::string& hash) const;
+    bool commit(const std::unique_lock<std::mutex>& lock) const;
+    bool defer(const Node* child, std::function<bool()> update) const;
     std::uint64_t extract_revision(const proto::Contact& input) const;
     std::uint64_t extract_revision(const proto::CredentialIndex& input) const;
     std::uint64_t extract_revision(const proto::Seed& input) const;
     std::string get_alias(const std::string& id) const;
+    void load_list(const proto::StorageNymList& serialized) const;
     bool load_raw(
         const std::string& id,
         std::string& output,
@@ -222,7 +283,11 @@ protected:
     bool migrate(
         const std::string& hash,
         const opentxs::api::storage::Driver& to) const;
+    bool migrate_chunks(const opentxs::api::storage::Driver& to) const;
     virtual bool save(const std::unique_lock<std::mutex>& lock) const = 0;
+    bool save_list(
+        const std::unique_lock<std::mutex>& lock,
+        const proto::StorageHashType type = proto::STORAGEHASH_PROTO) const;
     void serialize_index(
         const std::string& id,
         const Metadata& metadata,
@@ -241,6 +306,7 @@ protected:
         const std::string& data,
         const std::string& id,
         const std::string& alias);
+    void touch(const std::string& id) const;
     bool verify_write_lock(const std::unique_lock<std::mutex>& lock) const;
 
     virtual void init(const std::string& hash) = 0;
@@ -248,6 +314,12 @@ protected:
     Node(const opentxs::api::storage::Driver& storage, const std::string& key);
 
 public:
+    /** Defers index updates made by this thread until CommitBatch */
+    static void BeginBatch();
+    static bool Batching();
+    /** Writes each index touched since BeginBatch once, children first */
+    static bool CommitBatch();
+
     virtual ObjectList List() const;
     virtual bool Migrate(const opentxs::api::storage::Driver& to) const;
     std::string Root() const;
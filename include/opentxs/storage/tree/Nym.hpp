@@ -120,6 +120,7 @@ public:
     ~Nym();
 
 private:
+    friend class Node;
     friend class Nyms;
 
     std::string alias_;
@@ -62,6 +62,7 @@ class Tree;
 class Nyms : public Node
 {
 private:
+    friend class Node;
     friend class Tree;
 
     mutable std::map<std::string, std::unique_ptr<class Nym>> nyms_;
@@ -72,7 +73,6 @@ private:
 
     void init(const std::string& hash) override;
     bool save(const Lock& lock) const override;
-    proto::StorageNymList serialize() const;
 
     Nyms(const opentxs::api::storage::Driver& storage, const std::string& hash);
     Nyms() = delete;
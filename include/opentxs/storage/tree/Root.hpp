@@ -76,6 +76,7 @@ private:
     typedef Node ot_super;
     friend class opentxs::StorageMultiplex;
     friend class api::storage::implementation::Storage;
+    friend class Node;
 
     const std::uint64_t gc_interval_{std::numeric_limits<int64_t>::max()};
 
@@ -71,6 +71,8 @@ private:
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
     std::map<std::string, proto::StorageThreadItem> items_;
+    // Number of entries in items_ flagged unread
+    std::size_t unread_{0};
 
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
@@ -44,6 +44,7 @@
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/storage/tree/Node.hpp"
 
+#include <cstddef>
 #include <map>
 #include <mutex>
 #include <set>
@@ -63,14 +64,22 @@ class Threads : public Node
 {
 private:
     typedef Node ot_super;
+    friend class Node;
     friend class Nym;
 
     mutable std::map<std::string, std::unique_ptr<class Thread>> threads_;
+    // Unread item count of every thread which has been loaded at least once
+    mutable std::map<std::string, std::size_t> unread_;
+    mutable std::size_t unread_total_{0};
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
 
+    void count_all(const Lock& lock) const;
     bool save(const std::unique_lock<std::mutex>& lock) const override;
-    proto::StorageNymList serialize() const;
+    void set_unread(
+        const Lock& lock,
+        const std::string& id,
+        const std::size_t count) const;
     class Thread* thread(const std::string& id) const;
     class Thread* thread(
         const std::string& id,
@@ -103,6 +112,7 @@ public:
     ObjectList List(const bool unreadOnly) const;
     bool Migrate(const opentxs::api::storage::Driver& to) const override;
     const class Thread& Thread(const std::string& id) const;
+    std::size_t UnreadCount() const;
 
     std::string Create(
         const std::string& id,
@@ -74,6 +74,7 @@ class Tree : public Node
 {
 private:
     friend class api::Storage;
+    friend class Node;
     friend class Root;
 
     std::string blockchain_root_{Node::BLANK_HASH};
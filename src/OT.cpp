@@ -77,6 +77,8 @@ void OT::ClientFactory(
 {
     OT_ASSERT(nullptr == instance_pointer_);
 
+    // Cleanup() leaves the flag set, so clear it in case of a restart
+    shutdown_.store(false);
     instance_pointer_ = new api::implementation::Native(
         args, shutdown_, recover, false, gcInterval);
 
@@ -103,6 +105,8 @@ void OT::ServerFactory(
 {
     OT_ASSERT(nullptr == instance_pointer_);
 
+    // Cleanup() leaves the flag set, so clear it in case of a restart
+    shutdown_.store(false);
     instance_pointer_ = new api::implementation::Native(
         args, shutdown_, recover, true, gcInterval);
 
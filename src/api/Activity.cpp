@@ -76,19 +76,8 @@ bool Activity::AddBlockchainTransaction(
 {
     const std::string sNymID = String(nymID).Get();
     const std::string sthreadID = String(threadID).Get();
-    const auto threadList = storage_.ThreadList(sNymID, false);
-    bool threadExists = false;
 
-    for (const auto it : threadList) {
-        const auto& id = it.first;
-
-        if (id == sthreadID) {
-            threadExists = true;
-            break;
-        }
-    }
-
-    if (false == threadExists) {
+    if (false == storage_.ThreadExists(sNymID, sthreadID)) {
         storage_.CreateThread(sNymID, sthreadID, {sthreadID});
     }
 
@@ -207,19 +196,8 @@ std::string Activity::Mail(
     std::string alias = contact->Label();
     const std::string contactID = String(contact->ID()).Get();
     const auto& threadID = contactID;
-    const auto threadList = storage_.ThreadList(nymID, false);
-    bool threadExists = false;
 
-    for (const auto it : threadList) {
-        const auto& id = it.first;
-
-        if (id == threadID) {
-            threadExists = true;
-            break;
-        }
-    }
-
-    if (false == threadExists) {
+    if (false == storage_.ThreadExists(nymID, threadID)) {
         storage_.CreateThread(nymID, threadID, {contactID});
     }
 
@@ -535,16 +513,6 @@ ObjectList Activity::Threads(const Identifier& nym, const bool unreadOnly) const
 
 std::size_t Activity::UnreadCount(const Identifier& nymId) const
 {
-    const std::string nym = String(nymId).Get();
-    std::size_t output{0};
-
-    const auto& threads = storage_.ThreadList(nym, true);
-
-    for (const auto& it : threads) {
-        const auto& threadId = it.first;
-        output += storage_.UnreadCount(nym, threadId);
-    }
-
-    return output;
+    return storage_.UnreadCount(String(nymId).Get());
 }
 }  // namespace opentxs::api
@@ -88,6 +88,14 @@ Api::Api(
 
 void Api::Cleanup()
 {
+    if (sync_) {
+        auto sync = dynamic_cast<client::implementation::Sync*>(sync_.get());
+
+        OT_ASSERT(sync);
+
+        sync->Shutdown();
+    }
+
     pair_.reset();
     sync_.reset();
     ot_me_.reset();
@@ -168,6 +176,17 @@ void Api::Init()
     OT_ASSERT(pair_);
 }
 
+void Api::Start()
+{
+    OT_ASSERT(sync_);
+
+    auto sync = dynamic_cast<client::implementation::Sync*>(sync_.get());
+
+    OT_ASSERT(sync);
+
+    sync->Start();
+}
+
 const OTAPI_Exec& Api::Exec(const std::string&) const
 {
     OT_ASSERT(otapi_exec_);
@@ -197,6 +197,8 @@ ObjectList ContactManager::ContactList() const
 void ContactManager::import_contacts(const rLock& lock)
 {
     auto nyms = wallet_.NymList();
+    // Write the contact index once for the whole import
+    const storage::Batch batch(storage_);
 
     for (const auto& it : nyms) {
         const Identifier nymID(it.first);
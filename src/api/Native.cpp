@@ -984,6 +984,15 @@ void Native::start()
     activity_->MigrateLegacyThreads();
     Init_Periodic();
 
+    if (false == server_mode_) {
+        OT_ASSERT(api_);
+        auto api = dynamic_cast<implementation::Api*>(api_.get());
+
+        OT_ASSERT(api);
+
+        api->Start();
+    }
+
     if (server_mode_) {
         OT_ASSERT(server_);
         auto server = dynamic_cast<implementation::Server*>(server_.get());
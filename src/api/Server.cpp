@@ -65,6 +65,7 @@
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
 #define MINT_GENERATE_DAYS 7
+#define MINT_RESCAN_HOURS 1
 #endif  // OT_CASH
 
 #define OT_METHOD "opentxs::api::implementation::Server::"
@@ -175,11 +176,6 @@ void Server::generate_mint(
         100000);
 
     Lock mintLock(mint_lock_);
-
-    if (mints_.end() != mints_.find(unitID)) {
-        mints_.at(unitID).erase(PUBLIC_SERIES);
-    }
-
     mint->SetSavePrivateKeys();
     mint->SignContract(nym);
     mint->SaveContract();
@@ -189,6 +185,41 @@ void Server::generate_mint(
     mint->SignContract(nym);
     mint->SaveContract();
     mint->SaveMint(PUBLIC_SERIES);
+    mintLock.unlock();
+
+    // Load and verify the new series without holding mint_lock_, so getMint
+    // requests keep being served from the previous public mint until the new
+    // one is ready to be swapped in.
+    std::shared_ptr<Mint> privateMint(
+        Mint::MintFactory(serverID.c_str(), nymID.c_str(), unitID.c_str()));
+    std::shared_ptr<Mint> publicMint(
+        Mint::MintFactory(serverID.c_str(), unitID.c_str()));
+
+    OT_ASSERT(privateMint)
+    OT_ASSERT(publicMint)
+
+    const bool havePrivate =
+        privateMint->LoadMint(seriesID.c_str()) && privateMint->VerifyMint(nym);
+    const bool havePublic =
+        publicMint->LoadMint(PUBLIC_SERIES) && publicMint->VerifyMint(nym);
+
+    mintLock.lock();
+    auto& seriesMap = mints_[unitID];
+
+    if (havePrivate) {
+        seriesMap[seriesID] = privateMint;
+    } else {
+        seriesMap.erase(seriesID);
+    }
+
+    if (havePublic) {
+        seriesMap[PUBLIC_SERIES] = publicMint;
+    } else {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to load new public mint for " << unitID
+              << std::endl;
+        seriesMap.erase(PUBLIC_SERIES);
+    }
 }
 
 const std::string Server::get_arg(const std::string& argName) const
@@ -251,8 +282,6 @@ std::shared_ptr<Mint> Server::GetPrivateMint(
     }
 
     auto& seriesMap = currency->second;
-    // Modifying the private version may invalid the public version
-    seriesMap.erase(PUBLIC_SERIES);
     auto series = seriesMap.find(seriesID);
 
     if (seriesMap.end() == series) {
@@ -365,6 +394,10 @@ void Server::mint() const
 
     OT_ASSERT(false == serverID.empty());
 
+    const std::chrono::seconds rescanInterval(
+        std::chrono::hours(MINT_RESCAN_HOURS));
+    std::time_t lastScan = std::time(nullptr);
+
     while (false == shutdown_.load()) {
         Log::Sleep(std::chrono::milliseconds(250));
 
@@ -373,6 +406,16 @@ void Server::mint() const
             continue;
         }
 
+        // Periodically recheck every unit so the next series is generated
+        // MINT_GENERATE_DAYS ahead of expiry, rather than only when a
+        // request fails to find a valid mint.
+        const auto scanTime = std::time(nullptr);
+
+        if ((scanTime - lastScan) >= rescanInterval.count()) {
+            lastScan = scanTime;
+            ScanMints();
+        }
+
         std::string unitID{""};
         updateLock.lock();
 
@@ -44,6 +44,7 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/Types.hpp"
 
 // NOTE: cstdlib HAS to be included here above SimpleIni, since for some reason
 // it uses stdlib functions without including that header.
@@ -51,7 +52,10 @@
 #include <simpleini/SimpleIni.h>
 #include <stdint.h>
 #include <cinttypes>
+#include <cstdio>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 
@@ -65,12 +69,110 @@ private:
     SettingsPvt& operator=(const SettingsPvt&);
 
 public:
+    typedef std::map<std::string, std::map<std::string, std::string>> Snapshot;
+
     CSimpleIniA iniSimple;
+    // Guards iniSimple, dirty_ and path_, and serializes publishing. Recursive
+    // because the compound operations (CheckSet_*, Set_*) are built from the
+    // simple ones.
+    std::recursive_mutex lock_;
+    // True when iniSimple holds changes which have not been written to path_.
+    // Save() is a no-op otherwise, so callers which set several keys and
+    // call Save() after each one only cause the file to be rewritten when
+    // something actually changed.
+    bool dirty_;
+    // The file iniSimple was last loaded from or saved to
+    std::string path_;
+
+    // Reads go through an immutable copy of the key values, so Check_*
+    // never waits on a writer
+    bool Get(const String& section, const String& key, std::string& value)
+        const
+    {
+        const auto snapshot = std::atomic_load(&snapshot_);
+        const auto it = snapshot->find(section.Get());
+
+        if (snapshot->end() == it) {
+
+            return false;
+        }
+
+        const auto& keys = it->second;
+        const auto found = keys.find(key.Get());
+
+        if (keys.end() == found) {
+
+            return false;
+        }
+
+        value = found->second;
+
+        return true;
+    }
+
+    // Parses a value the same way CSimpleIniA::GetLongValue does
+    static std::int64_t ToLong(const std::string& value)
+    {
+        const char* number = value.c_str();
+        char* suffix = nullptr;
+        std::int64_t output{0};
+
+        if (('0' == number[0]) && (('x' == number[1]) || ('X' == number[1]))) {
+            if ('\0' == number[2]) {
+
+                return 0;
+            }
+
+            output = std::strtoll(&number[2], &suffix, 16);
+        } else {
+            output = std::strtoll(number, &suffix, 10);
+        }
+
+        if ('\0' != *suffix) {
+
+            return 0;
+        }
+
+        return output;
+    }
+
+    // Must be called with lock_ held after every change to iniSimple
+    void Publish()
+    {
+        auto snapshot = std::make_shared<Snapshot>();
+        CSimpleIniA::TNamesDepend sections{};
+        iniSimple.GetAllSections(sections);
+
+        for (const auto& section : sections) {
+            auto& keys = (*snapshot)[section.pItem];
+            CSimpleIniA::TNamesDepend names{};
+            iniSimple.GetAllKeys(section.pItem, names);
+
+            for (const auto& name : names) {
+                const char* value =
+                    iniSimple.GetValue(section.pItem, name.pItem, nullptr);
+
+                if (nullptr != value) {
+                    keys.emplace(name.pItem, value);
+                }
+            }
+        }
+
+        std::atomic_store(
+            &snapshot_, std::shared_ptr<const Snapshot>(snapshot));
+    }
 
     SettingsPvt()
         : iniSimple()
+        , lock_()
+        , dirty_(false)
+        , path_()
+        , snapshot_(std::make_shared<Snapshot>())
     {
     }
+
+private:
+    std::shared_ptr<const Snapshot> snapshot_;
 };
 
 bool Settings::Init() const
@@ -98,6 +200,8 @@ bool Settings::Init() const
 
 bool Settings::Load(const String& strConfigurationFileExactPath) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strConfigurationFileExactPath.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strConfigurationFileExactPath"
@@ -134,14 +238,22 @@ bool Settings::Load(const String& strConfigurationFileExactPath) const
     }
 
     SI_Error rc = pvt_->iniSimple.LoadFile(strConfigurationFileExactPath.Get());
+    pvt_->Publish();
+
     if (0 > rc)
         return false;
-    else
+    else {
+        pvt_->dirty_ = false;
+        pvt_->path_ = strConfigurationFileExactPath.Get();
+
         return true;
+    }
 }
 
 bool Settings::Save(const String& strConfigurationFileExactPath) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strConfigurationFileExactPath.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strConfigurationFileExactPath"
@@ -149,11 +261,33 @@ bool Settings::Save(const String& strConfigurationFileExactPath) const
         return false;
     }
 
-    SI_Error rc = pvt_->iniSimple.SaveFile(strConfigurationFileExactPath.Get());
-    if (0 > rc)
+    const std::string path = strConfigurationFileExactPath.Get();
+
+    if ((false == pvt_->dirty_) && (path == pvt_->path_)) return true;
+
+    // Write the new contents next to the config file and move them into
+    // place, so a crash mid-write never leaves a truncated config behind.
+    const std::string temp = path + ".tmp";
+    SI_Error rc = pvt_->iniSimple.SaveFile(temp.c_str());
+
+    if (0 > rc) {
+        std::remove(temp.c_str());
+
         return false;
-    else
-        return true;
+    }
+
+    if (0 != std::rename(temp.c_str(), path.c_str())) {
+        // Some platforms refuse to rename over an existing file.
+        std::remove(temp.c_str());
+        rc = pvt_->iniSimple.SaveFile(path.c_str());
+
+        if (0 > rc) return false;
+    }
+
+    pvt_->dirty_ = false;
+    pvt_->path_ = path;
+
+    return true;
 }
 
 bool Settings::LogChange_str(
@@ -243,12 +377,21 @@ const std::atomic<bool>& Settings::IsLoaded() const { return b_Loaded; }
 
 bool Settings::Reset() const
 {
+    rLock lock(pvt_->lock_);
+
     b_Loaded = false;
     pvt_->iniSimple.Reset();
+    pvt_->Publish();
+    pvt_->dirty_ = true;
     return true;
 }
 
-bool Settings::IsEmpty() const { return pvt_->iniSimple.IsEmpty(); }
+bool Settings::IsEmpty() const
+{
+    rLock lock(pvt_->lock_);
+
+    return pvt_->iniSimple.IsEmpty();
+}
 
 bool Settings::Check_str(
     const String& strSection,
@@ -282,9 +425,9 @@ bool Settings::Check_str(
         OT_FAIL;
     }
 
-    const char* szVar =
-        pvt_->iniSimple.GetValue(strSection.Get(), strKey.Get(), nullptr);
-    String strVar(szVar);
+    std::string value{};
+    const bool found = pvt_->Get(strSection, strKey, value);
+    String strVar(found ? value.c_str() : nullptr);
 
     if (strVar.Exists() && !strVar.Compare("")) {
         out_bKeyExist = true;
@@ -329,14 +472,13 @@ bool Settings::Check_long(
         OT_FAIL;
     }
 
-    const char* szVar =
-        pvt_->iniSimple.GetValue(strSection.Get(), strKey.Get(), nullptr);
-    String strVar(szVar);
+    std::string value{};
+    const bool found = pvt_->Get(strSection, strKey, value);
+    String strVar(found ? value.c_str() : nullptr);
 
     if (strVar.Exists() && !strVar.Compare("")) {
         out_bKeyExist = true;
-        out_lResult =
-            pvt_->iniSimple.GetLongValue(strSection.Get(), strKey.Get(), 0);
+        out_lResult = SettingsPvt::ToLong(value);
     } else {
         out_bKeyExist = false;
         out_lResult = 0;
@@ -377,9 +519,9 @@ bool Settings::Check_bool(
         OT_FAIL;
     }
 
-    const char* szVar =
-        pvt_->iniSimple.GetValue(strSection.Get(), strKey.Get(), nullptr);
-    String strVar(szVar);
+    std::string value{};
+    const bool found = pvt_->Get(strSection, strKey, value);
+    String strVar(found ? value.c_str() : nullptr);
 
     if (strVar.Exists() &&
         (strVar.Compare("false") || strVar.Compare("true"))) {
@@ -403,6 +545,8 @@ bool Settings::Set_str(
     bool& out_bNewOrUpdate,
     const String& strComment) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -459,6 +603,9 @@ bool Settings::Set_str(
         strSection.Get(), strKey.Get(), szValue, szComment, true);
     if (0 > rc) return false;
 
+    pvt_->dirty_ = true;
+    pvt_->Publish();
+
     if (nullptr ==
         szValue)  // We set the key's value to null, thus removing it.
     {
@@ -492,6 +639,8 @@ bool Settings::Set_long(
     bool& out_bNewOrUpdate,
     const String& strComment) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -546,6 +695,9 @@ bool Settings::Set_long(
         strSection.Get(), strKey.Get(), lValue, szComment, false, true);
     if (0 > rc) return false;
 
+    pvt_->dirty_ = true;
+    pvt_->Publish();
+
     // Check if the new value is the same as intended.
     if (!Check_str(strSection, strKey, strNewValue, bNewKeyExist)) return false;
 
@@ -590,6 +742,8 @@ bool Settings::CheckSetSection(
     const String& strComment,
     bool& out_bIsNewSection) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -615,6 +769,8 @@ bool Settings::CheckSetSection(
         SI_Error rc = pvt_->iniSimple.SetValue(
             strSection.Get(), nullptr, nullptr, szComment, false);
         if (0 > rc) return false;
+
+        pvt_->dirty_ = true;
     } else {
         out_bIsNewSection = false;
     }
@@ -645,6 +801,8 @@ bool Settings::CheckSet_str(
     bool& out_bIsNew,
     const String& strComment) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -704,6 +862,8 @@ bool Settings::CheckSet_long(
     bool& out_bIsNew,
     const String& strComment) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -750,6 +910,8 @@ bool Settings::CheckSet_bool(
     bool& out_bIsNew,
     const String& strComment) const
 {
+    rLock lock(pvt_->lock_);
+
     if (!strSection.Exists()) {
         otErr << __FUNCTION__ << ": Error: "
               << "strSection"
@@ -56,7 +56,10 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Nym.hpp"
 
+#include <algorithm>
+
 #define MINIMUM_UNUSED_BAILMENTS 3
+#define PAIRING_THREADS 4
 
 #define SHUTDOWN()                                                             \
     {                                                                          \
@@ -145,33 +148,65 @@ bool Pair::AddIssuer(
     return true;
 }
 
+// Issuer relationships are advanced by a fixed pool of threads. The state
+// machines spend most of their time waiting on the network (and on the
+// throttle in SHUTDOWN()), so walking them one after another makes pairing
+// latency grow with the number of issuers, while a thread per issuer makes
+// the thread count grow with it instead.
 void Pair::check_pairing() const
 {
     Cleanup cleanup(pairing_);
+    std::vector<IssuerID> pairs{};
 
     for (const auto & [ nymID, issuerSet ] : create_issuer_map()) {
-        SHUTDOWN()
-
         for (const auto& issuerID : issuerSet) {
-            SHUTDOWN()
+            pairs.emplace_back(nymID, issuerID);
+        }
+    }
+
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() -> void {
+        for (auto i = next++; i < pairs.size(); i = next++) {
+            if (shutdown_.load()) return;
 
+            const auto & [ nymID, issuerID ] = pairs.at(i);
             state_machine(nymID, issuerID);
         }
+    };
+    const auto threads = std::min<std::size_t>(PAIRING_THREADS, pairs.size());
+    std::vector<std::thread> machines{};
+
+    for (std::size_t i = 1; i < threads; ++i) {
+        machines.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& machine : machines) {
+        if (machine.joinable()) {
+            machine.join();
+        }
     }
 }
 
 void Pair::check_refresh() const
 {
+    auto current = last_refresh_.load();
+
     while (false == shutdown_.load()) {
-        const auto current = sync_.RefreshCount();
+        // Blocks until Sync completes a refresh, or until shutdown.
+        current = sync_.WaitForRefresh(current);
+
+        if (shutdown_.load()) {
+            return;
+        }
+
         const auto previous = last_refresh_.exchange(current);
 
         if (previous != current) {
             update_pairing();
             update_peer();
         }
-
-        Log::Sleep(std::chrono::milliseconds(100));
     }
 }
 
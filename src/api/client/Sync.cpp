@@ -53,22 +53,31 @@
 #include "opentxs/contact/ContactData.hpp"
 #include "opentxs/contact/ContactGroup.hpp"
 #include "opentxs/contact/ContactItem.hpp"
+#include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/crypto/OTEnvelope.hpp"
 #include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/Cheque.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <sstream>
+#include <string>
 
 #include "Sync.hpp"
 
 #define CONTACT_REFRESH_DAYS 1
 #define CONTRACT_DOWNLOAD_SECONDS 10
 #define MAIN_LOOP_SECONDS 5
+#define MAX_BACKOFF_SECONDS 300
+#define MAX_PENDING_TASKS 1024
 #define NYM_REGISTRATION_SECONDS 10
 
 #define SHUTDOWN()                                                             \
@@ -115,9 +124,19 @@
         }                                                                      \
     }
 
+#define CHECK_CAPACITY()                                                       \
+    {                                                                          \
+        if (false == have_capacity()) {                                        \
+                                                                               \
+            return {};                                                         \
+        }                                                                      \
+    }
+
 #define INTRODUCTION_SERVER_KEY "introduction_server_id"
 #define MASTER_SECTION "Master"
+#define PENDING_TASKS_FILE "pending_tasks"
 #define PROCESS_INBOX_RETRIES 3
+#define SYNC_FOLDER "sync"
 
 #define OT_METHOD "opentxs::api::client::implementation::Sync::"
 
@@ -196,6 +215,8 @@ Sync::Sync(
     , nym_fetch_lock_()
     , task_status_lock_()
     , refresh_counter_(0)
+    , refresh_lock_()
+    , refresh_()
     , operations_()
     , server_nym_fetch_()
     , missing_nyms_()
@@ -203,6 +224,12 @@ Sync::Sync(
     , state_machines_()
     , introduction_server_id_()
     , task_status_()
+    , task_callbacks_()
+    , running_tasks_(0)
+    , task_slots_()
+    , pending_tasks_()
+    , server_failures_lock_()
+    , server_failures_()
 {
 }
 
@@ -290,7 +317,7 @@ std::pair<bool, std::size_t> Sync::accept_incoming(
     auto action = server_action_.ProcessInbox(
         context.Nym()->ID(), context.Server(), accountID, *response);
     action->Run();
-    success = (SendResult::VALID_REPLY == action->LastSendResult());
+    success = check_reply(context.Server(), action->LastSendResult());
 
     return output;
 }
@@ -358,6 +385,16 @@ void Sync::add_task(const Identifier& taskID, const ThreadStatus status) const
     }
 
     task_status_[taskID] = status;
+    task_slots_[taskID].reset(new TaskSlot(running_tasks_));
+}
+
+// Each field is written as its length, a colon and its contents, so that
+// fields may be empty or contain any character
+void Sync::append_field(std::string& output, const std::string& field)
+{
+    output += std::to_string(field.size());
+    output += ':';
+    output += field;
 }
 
 Depositability Sync::can_deposit(
@@ -587,6 +624,24 @@ void Sync::check_nym_revision(
     }
 }
 
+// Tracks consecutive communication failures per notary so the state machines
+// for that notary back off instead of retrying on every pass
+bool Sync::check_reply(const Identifier& serverID, const SendResult result)
+    const
+{
+    const bool output = (SendResult::VALID_REPLY == result);
+    Lock lock(server_failures_lock_);
+    auto& failures = server_failures_[serverID];
+
+    if (output) {
+        failures = 0;
+    } else {
+        ++failures;
+    }
+
+    return output;
+}
+
 bool Sync::check_registration(
     const Identifier& nymID,
     const Identifier& serverID,
@@ -675,7 +730,7 @@ bool Sync::deposit_cheque(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -720,6 +775,8 @@ Identifier Sync::DepositPayment(
         return {};
     }
 
+    CHECK_CAPACITY()
+
     Identifier serverID{};
     Identifier accountID{};
     const auto status = can_deposit(
@@ -732,6 +789,13 @@ Identifier Sync::DepositPayment(
             start_introduction_server(recipientNymID);
             auto& queue = get_operations({recipientNymID, serverID});
             const auto taskID(random_id());
+            persist_task(
+                taskID,
+                {TaskType::DEPOSIT_PAYMENT,
+                 recipientNymID,
+                 serverID,
+                 accountIDHint,
+                 String(*payment).Get()});
 
             return start_task(
                 taskID,
@@ -777,7 +841,7 @@ bool Sync::download_contract(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -813,7 +877,7 @@ bool Sync::download_nym(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -936,6 +1000,7 @@ bool Sync::find_server(
 Identifier Sync::FindNym(const Identifier& nymID) const
 {
     CHECK_NYM(nymID)
+    CHECK_CAPACITY()
 
     const auto taskID(random_id());
 
@@ -947,6 +1012,7 @@ Identifier Sync::FindNym(
     const Identifier& serverIDHint) const
 {
     CHECK_NYM(nymID)
+    CHECK_CAPACITY()
 
     auto& serverQueue = get_nym_fetch(serverIDHint);
     const auto taskID(random_id());
@@ -957,6 +1023,7 @@ Identifier Sync::FindNym(
 Identifier Sync::FindServer(const Identifier& serverID) const
 {
     CHECK_NYM(serverID)
+    CHECK_CAPACITY()
 
     const auto taskID(random_id());
 
@@ -965,15 +1032,45 @@ Identifier Sync::FindServer(const Identifier& serverID) const
 
 bool Sync::finish_task(const Identifier& taskID, const bool success) const
 {
-    if (success) {
-        update_task(taskID, ThreadStatus::FINISHED_SUCCESS);
-    } else {
-        update_task(taskID, ThreadStatus::FINISHED_FAILED);
+    const auto status = success ? ThreadStatus::FINISHED_SUCCESS
+                                : ThreadStatus::FINISHED_FAILED;
+    update_task(taskID, status);
+    forget_task(taskID);
+    TaskCallback callback{};
+    Lock lock(task_status_lock_);
+    task_slots_.erase(taskID);
+    auto it = task_callbacks_.find(taskID);
+
+    if (task_callbacks_.end() != it) {
+        callback = it->second;
+        task_callbacks_.erase(it);
+        task_status_.erase(taskID);
     }
 
+    lock.unlock();
+
+    if (callback) callback(taskID, status);
+
     return success;
 }
 
+void Sync::forget_task(const Identifier& taskID) const
+{
+    Lock lock(task_status_lock_);
+    auto it = pending_tasks_.find(taskID);
+
+    if (pending_tasks_.end() == it) {
+
+        return;
+    }
+
+    const String nymID(it->second);
+    pending_tasks_.erase(it);
+    save_task_index(lock);
+    lock.unlock();
+    OTDB::EraseValueByKey(SYNC_FOLDER, nymID.Get(), String(taskID).Get());
+}
+
 bool Sync::get_admin(
     const Identifier& nymID,
     const Identifier& serverID,
@@ -992,7 +1089,7 @@ bool Sync::get_admin(
         action->Run();
         lock.unlock();
 
-        if (SendResult::VALID_REPLY == action->LastSendResult()) {
+        if (check_reply(serverID, action->LastSendResult())) {
             auto reply = action->Reply();
 
             OT_ASSERT(reply)
@@ -1053,6 +1150,20 @@ Sync::OperationQueue& Sync::get_operations(const ContextID& id) const
     return queue;
 }
 
+bool Sync::have_capacity() const
+{
+    const auto running = running_tasks_.load();
+
+    if (MAX_PENDING_TASKS <= running) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Too many pending tasks ("
+              << running << ")" << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
 Identifier Sync::import_default_introduction_server(const Lock& lock) const
 {
     OT_ASSERT(verify_lock(lock, introduction_server_lock_))
@@ -1087,6 +1198,65 @@ void Sync::load_introduction_server(const Lock& lock) const
         new Identifier(get_introduction_server(lock)));
 }
 
+bool Sync::load_task(
+    const Identifier& nymID,
+    const Identifier& taskID,
+    PendingTask& task) const
+{
+    const auto armored = OTDB::QueryPlainString(
+        SYNC_FOLDER, String(nymID).Get(), String(taskID).Get());
+
+    if (armored.empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Missing task "
+              << String(taskID) << std::endl;
+
+        return false;
+    }
+
+    const auto nym = wallet_.Nym(nymID);
+
+    if (false == bool(nym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load nym "
+              << String(nymID) << std::endl;
+
+        return false;
+    }
+
+    OTEnvelope envelope(OTASCIIArmor(armored.c_str()));
+    String plaintext{};
+
+    if (false == envelope.Open(*nym, plaintext)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to decrypt task "
+              << String(taskID) << std::endl;
+
+        return false;
+    }
+
+    const std::string input(plaintext.Get());
+    std::size_t position{0};
+    std::string type{}, serverID{}, targetID{}, payload{};
+    const bool parsed = read_field(input, position, type) &&
+                        read_field(input, position, serverID) &&
+                        read_field(input, position, targetID) &&
+                        read_field(input, position, payload) &&
+                        (1 == type.size());
+
+    if (false == parsed) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid task "
+              << String(taskID) << std::endl;
+
+        return false;
+    }
+
+    task = PendingTask{static_cast<TaskType>(type.front() - '0'),
+                       nymID,
+                       Identifier(serverID),
+                       Identifier(targetID),
+                       payload};
+
+    return true;
+}
+
 bool Sync::message_nym(
     const Identifier& taskID,
     const Identifier& nymID,
@@ -1104,7 +1274,7 @@ bool Sync::message_nym(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -1131,6 +1301,7 @@ Identifier Sync::MessageContact(
     const std::string& message) const
 {
     CHECK_SERVER(senderNymID, contactID)
+    CHECK_CAPACITY()
 
     start_introduction_server(senderNymID);
     Identifier serverID;
@@ -1148,11 +1319,32 @@ Identifier Sync::MessageContact(
 
     auto& queue = get_operations({senderNymID, serverID});
     const auto taskID(random_id());
+    persist_task(
+        taskID,
+        {TaskType::SEND_MESSAGE,
+         senderNymID,
+         serverID,
+         recipientNymID,
+         message});
 
     return start_task(
         taskID, queue.send_message_.Push(taskID, {recipientNymID, message}));
 }
 
+void Sync::persist_task(const Identifier& taskID, const PendingTask& task) const
+{
+    if (false == save_task(taskID, task)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Task " << String(taskID)
+              << " will not survive a restart" << std::endl;
+
+        return;
+    }
+
+    Lock lock(task_status_lock_);
+    pending_tasks_[taskID] = std::get<1>(task);
+    save_task_index(lock);
+}
+
 bool Sync::publish_server_registration(
     const Identifier& nymID,
     const Identifier& serverID,
@@ -1183,11 +1375,67 @@ void Sync::Refresh() const
     SHUTDOWN()
 
     refresh_contacts();
+    Lock lock(refresh_lock_);
     ++refresh_counter_;
+    lock.unlock();
+    refresh_.notify_all();
 }
 
 std::uint64_t Sync::RefreshCount() const { return refresh_counter_.load(); }
 
+void Sync::Shutdown() const
+{
+    Lock lock(refresh_lock_);
+    lock.unlock();
+    refresh_.notify_all();
+}
+
+std::uint64_t Sync::WaitForRefresh(const std::uint64_t previous) const
+{
+    Lock lock(refresh_lock_);
+    refresh_.wait(lock, [&]() -> bool {
+        return shutdown_.load() || (previous != refresh_counter_.load());
+    });
+
+    return refresh_counter_.load();
+}
+
+bool Sync::read_field(
+    const std::string& input,
+    std::size_t& position,
+    std::string& output)
+{
+    const auto colon = input.find(':', position);
+
+    if (std::string::npos == colon) {
+
+        return false;
+    }
+
+    const auto length = input.substr(position, colon - position);
+    const bool valid = (false == length.empty()) && (length.size() < 16) &&
+                       (std::string::npos ==
+                        length.find_first_not_of("0123456789"));
+
+    if (false == valid) {
+
+        return false;
+    }
+
+    const std::size_t size = std::stoull(length);
+    const auto start = colon + 1;
+
+    if (size > (input.size() - start)) {
+
+        return false;
+    }
+
+    output = input.substr(start, size);
+    position = start + size;
+
+    return true;
+}
+
 void Sync::refresh_accounts() const
 {
     otInfo << OT_METHOD << __FUNCTION__ << ": Begin" << std::endl;
@@ -1347,7 +1595,7 @@ bool Sync::register_account(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -1380,7 +1628,7 @@ bool Sync::register_nym(
     action->Run();
     lock.unlock();
 
-    if (SendResult::VALID_REPLY == action->LastSendResult()) {
+    if (check_reply(serverID, action->LastSendResult())) {
         OT_ASSERT(action->Reply());
 
         if (action->Reply()->m_bSuccess) {
@@ -1416,6 +1664,138 @@ Identifier Sync::RegisterNym(
     return ScheduleRegisterNym(nymID, serverID);
 }
 
+// Each line of the index is: nymID taskID
+void Sync::restore_tasks() const
+{
+    if (false == OTDB::Exists(SYNC_FOLDER, PENDING_TASKS_FILE)) {
+
+        return;
+    }
+
+    std::istringstream input(
+        OTDB::QueryPlainString(SYNC_FOLDER, PENDING_TASKS_FILE));
+    std::string line{};
+    std::size_t restored{0};
+
+    while (std::getline(input, line)) {
+        std::istringstream fields(line);
+        std::string nym{}, task{};
+        fields >> nym >> task;
+        const Identifier nymID(nym), taskID(task);
+        PendingTask pending{};
+
+        if (nymID.empty() || taskID.empty() ||
+            (false == load_task(nymID, taskID, pending))) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid task" << std::endl;
+
+            continue;
+        }
+
+        const auto & [ type, localNymID, serverID, targetID, payload ] =
+            pending;
+
+        if (serverID.empty()) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid task" << std::endl;
+
+            continue;
+        }
+
+        add_task(taskID, ThreadStatus::RUNNING);
+
+        {
+            Lock lock(task_status_lock_);
+            pending_tasks_[taskID] = localNymID;
+        }
+
+        auto& queue = get_operations({localNymID, serverID});
+        bool queued{false};
+
+        switch (type) {
+            case TaskType::DEPOSIT_PAYMENT: {
+                auto payment =
+                    std::make_shared<const OTPayment>(String(payload.c_str()));
+                queued =
+                    queue.deposit_payment_.Push(taskID, {targetID, payment});
+            } break;
+            case TaskType::REGISTER_ACCOUNT: {
+                queued = queue.register_account_.Push(taskID, targetID);
+            } break;
+            case TaskType::SEND_MESSAGE: {
+                queued = queue.send_message_.Push(taskID, {targetID, payload});
+            } break;
+            default: {
+                otErr << OT_METHOD << __FUNCTION__ << ": Unknown task type"
+                      << std::endl;
+            }
+        }
+
+        if (queued) {
+            ++restored;
+        } else {
+            forget_task(taskID);
+            Lock lock(task_status_lock_);
+            task_status_.erase(taskID);
+            task_slots_.erase(taskID);
+        }
+    }
+
+    otWarn << OT_METHOD << __FUNCTION__ << ": Restored " << restored
+           << " pending tasks." << std::endl;
+}
+
+// Pending tasks carry message text and payment instruments, so each one is
+// sealed to its local nym and stored under sync/<nymID>/<taskID>. The index
+// only records which tasks exist.
+bool Sync::save_task(const Identifier& taskID, const PendingTask& task) const
+{
+    const auto & [ type, nymID, serverID, targetID, payload ] = task;
+    const auto nym = wallet_.Nym(nymID);
+
+    if (false == bool(nym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load nym "
+              << String(nymID) << std::endl;
+
+        return false;
+    }
+
+    std::string plaintext{};
+    append_field(plaintext, std::to_string(static_cast<int>(type)));
+    append_field(plaintext, String(serverID).Get());
+    append_field(plaintext, String(targetID).Get());
+    append_field(plaintext, payload);
+    OTEnvelope envelope{};
+    OTASCIIArmor armored{};
+    const bool sealed = envelope.Seal(*nym, String(plaintext)) &&
+                        envelope.GetCiphertext(armored);
+
+    if (false == sealed) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to encrypt task "
+              << String(taskID) << std::endl;
+
+        return false;
+    }
+
+    return OTDB::StorePlainString(
+        armored.Get(), SYNC_FOLDER, String(nymID).Get(), String(taskID).Get());
+}
+
+void Sync::save_task_index(const Lock& lock) const
+{
+    OT_ASSERT(verify_lock(lock, task_status_lock_))
+
+    std::ostringstream output{};
+
+    for (const auto & [ taskID, nymID ] : pending_tasks_) {
+        output << String(nymID) << " " << String(taskID) << "\n";
+    }
+
+    if (false == OTDB::StorePlainString(
+                     output.str(), SYNC_FOLDER, PENDING_TASKS_FILE)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save pending tasks"
+              << std::endl;
+    }
+}
+
 Identifier Sync::SetIntroductionServer(const ServerContract& contract) const
 {
     Lock lock(introduction_server_lock_);
@@ -1428,6 +1808,7 @@ Identifier Sync::schedule_download_nymbox(
     const Identifier& serverID) const
 {
     CHECK_SERVER(localNymID, serverID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
@@ -1442,10 +1823,14 @@ Identifier Sync::schedule_register_account(
     const Identifier& unitID) const
 {
     CHECK_ARGS(localNymID, serverID, unitID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(random_id());
+    persist_task(
+        taskID,
+        {TaskType::REGISTER_ACCOUNT, localNymID, serverID, unitID, ""});
 
     return start_task(taskID, queue.register_account_.Push(taskID, unitID));
 }
@@ -1456,6 +1841,7 @@ Identifier Sync::ScheduleDownloadAccount(
     const Identifier& accountID) const
 {
     CHECK_ARGS(localNymID, serverID, accountID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
@@ -1470,6 +1856,7 @@ Identifier Sync::ScheduleDownloadContract(
     const Identifier& contractID) const
 {
     CHECK_ARGS(localNymID, serverID, contractID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
@@ -1485,6 +1872,7 @@ Identifier Sync::ScheduleDownloadNym(
     const Identifier& targetNymID) const
 {
     CHECK_ARGS(localNymID, serverID, targetNymID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
@@ -1505,6 +1893,7 @@ Identifier Sync::ScheduleRegisterNym(
     const Identifier& serverID) const
 {
     CHECK_SERVER(localNymID, serverID)
+    CHECK_CAPACITY()
 
     start_introduction_server(localNymID);
     auto& queue = get_operations({localNymID, serverID});
@@ -1513,6 +1902,50 @@ Identifier Sync::ScheduleRegisterNym(
     return start_task(taskID, queue.register_nym_.Push(taskID, true));
 }
 
+void Sync::SetTaskCallback(
+    const Identifier& taskID,
+    const TaskCallback& callback) const
+{
+    if (false == bool(callback)) {
+
+        return;
+    }
+
+    Lock lock(task_status_lock_);
+    auto it = task_status_.find(taskID);
+
+    if (task_status_.end() == it) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unknown task "
+              << String(taskID) << std::endl;
+
+        return;
+    }
+
+    const auto status = it->second;
+
+    if (ThreadStatus::RUNNING == status) {
+        task_callbacks_[taskID] = callback;
+
+        return;
+    }
+
+    task_status_.erase(it);
+    lock.unlock();
+    callback(taskID, status);
+}
+
+// Doubles the main loop delay for each consecutive communication failure with
+// the notary, up to MAX_BACKOFF_SECONDS
+std::chrono::seconds Sync::server_delay(const Identifier& serverID) const
+{
+    Lock lock(server_failures_lock_);
+    const auto failures = std::min<std::size_t>(server_failures_[serverID], 6);
+    lock.unlock();
+    const std::chrono::seconds delay(MAIN_LOOP_SECONDS << failures);
+
+    return std::min(delay, std::chrono::seconds(MAX_BACKOFF_SECONDS));
+}
+
 Identifier Sync::set_introduction_server(
     const Lock& lock,
     const ServerContract& contract) const
@@ -1542,6 +1975,8 @@ Identifier Sync::set_introduction_server(
     return id;
 }
 
+void Sync::Start() const { restore_tasks(); }
+
 void Sync::start_introduction_server(const Identifier& nymID) const
 {
     auto& serverID = IntroductionServer();
@@ -1564,6 +1999,7 @@ Identifier Sync::start_task(const Identifier& taskID, bool success) const
     }
 
     if (false == success) {
+        forget_task(taskID);
 
         return {};
     }
@@ -1866,6 +2302,7 @@ void Sync::state_machine(const ContextID id, OperationQueue& queue) const
                     otErr << OT_METHOD << __FUNCTION__
                           << ": Permanent failure trying to deposit payment"
                           << std::endl;
+                    finish_task(taskID, false);
                 }
             }
         }
@@ -1879,7 +2316,14 @@ void Sync::state_machine(const ContextID id, OperationQueue& queue) const
 
         SHUTDOWN()
 
-        Log::Sleep(std::chrono::seconds(MAIN_LOOP_SECONDS));
+        const auto delay = server_delay(serverID);
+        const auto wake = std::chrono::steady_clock::now() + delay;
+
+        while (std::chrono::steady_clock::now() < wake) {
+            SHUTDOWN()
+
+            Log::Sleep(std::chrono::seconds(1));
+        }
     }
 }
 
@@ -1936,28 +2380,14 @@ Depositability Sync::valid_account(
     const Identifier& accountIDHint,
     Identifier& depositAccount) const
 {
-    const auto accounts = ot_api_.Accounts();
-    std::set<Identifier> matchingAccounts{};
-
-    for (const auto & [ accountID, nymID, serverID, unitID ] : accounts) {
-        if (nymID != recipient) {
+    if (recipient.empty() || paymentServerID.empty() || paymentUnitID.empty()) {
 
-            continue;
-        }
-
-        if (serverID != paymentServerID) {
-
-            continue;
-        }
-
-        if (unitID != paymentUnitID) {
-
-            continue;
-        }
-
-        matchingAccounts.emplace(accountID);
+        return Depositability::NO_ACCOUNT;
     }
 
+    const auto matchingAccounts =
+        ot_api_.Accounts(recipient, paymentServerID, paymentUnitID);
+
     if (accountIDHint.empty()) {
         if (0 == matchingAccounts.size()) {
 
@@ -46,6 +46,8 @@
 #include "opentxs/core/UniqueQueue.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <map>
 #include <thread>
@@ -120,8 +122,18 @@ public:
     Identifier ScheduleRegisterNym(
         const Identifier& localNymID,
         const Identifier& serverID) const override;
+    void SetTaskCallback(
+        const Identifier& taskID,
+        const TaskCallback& callback) const override;
     void StartIntroductionServer(const Identifier& localNymID) const override;
     ThreadStatus Status(const Identifier& taskID) const override;
+    std::uint64_t WaitForRefresh(const std::uint64_t previous) const override;
+
+    /** Wakes any thread blocked in WaitForRefresh so it can observe shutdown */
+    void Shutdown() const;
+    /** Requeues tasks which were still pending when the client last shut down.
+     *  Requires the wallet, since each task is sealed to its local nym. */
+    void Start() const;
 
     ~Sync();
 
@@ -138,6 +150,40 @@ private:
     using DepositPaymentTask =
         std::pair<Identifier, std::shared_ptr<const OTPayment>>;
 
+    /** Tasks which carry caller data that would be lost on restart */
+    enum class TaskType : std::uint8_t {
+        ERROR = 0,
+        DEPOSIT_PAYMENT = 1,
+        REGISTER_ACCOUNT = 2,
+        SEND_MESSAGE = 3,
+    };
+
+    /** PendingTask: type, localNymID, serverID, targetID, payload */
+    using PendingTask =
+        std::tuple<TaskType, Identifier, Identifier, Identifier, std::string>;
+
+    /** Counts a task against MAX_PENDING_TASKS for as long as it exists */
+    class TaskSlot
+    {
+    public:
+        explicit TaskSlot(std::atomic<std::size_t>& counter)
+            : counter_(counter)
+        {
+            ++counter_;
+        }
+
+        ~TaskSlot() { --counter_; }
+
+    private:
+        std::atomic<std::size_t>& counter_;
+
+        TaskSlot() = delete;
+        TaskSlot(const TaskSlot&) = delete;
+        TaskSlot(TaskSlot&&) = delete;
+        TaskSlot& operator=(const TaskSlot&) = delete;
+        TaskSlot& operator=(TaskSlot&&) = delete;
+    };
+
     struct OperationQueue {
         UniqueQueue<Identifier> check_nym_;
         UniqueQueue<DepositPaymentTask> deposit_payment_;
@@ -162,6 +208,8 @@ private:
     mutable std::mutex nym_fetch_lock_{};
     mutable std::mutex task_status_lock_{};
     mutable std::atomic<std::uint64_t> refresh_counter_{0};
+    mutable std::mutex refresh_lock_{};
+    mutable std::condition_variable refresh_{};
     mutable std::map<ContextID, OperationQueue> operations_;
     mutable std::map<Identifier, UniqueQueue<Identifier>> server_nym_fetch_;
     UniqueQueue<Identifier> missing_nyms_;
@@ -169,6 +217,13 @@ private:
     mutable std::map<ContextID, std::unique_ptr<std::thread>> state_machines_;
     mutable std::unique_ptr<Identifier> introduction_server_id_;
     mutable std::map<Identifier, ThreadStatus> task_status_;
+    mutable std::map<Identifier, TaskCallback> task_callbacks_;
+    mutable std::atomic<std::size_t> running_tasks_{0};
+    mutable std::map<Identifier, std::unique_ptr<TaskSlot>> task_slots_;
+    /** Persisted tasks: taskID, localNymID */
+    mutable std::map<Identifier, Identifier> pending_tasks_;
+    mutable std::mutex server_failures_lock_{};
+    mutable std::map<Identifier, std::size_t> server_failures_;
 
     std::pair<bool, std::size_t> accept_incoming(
         const rLock& lock,
@@ -176,6 +231,7 @@ private:
         const Identifier& accountID,
         ServerContext& context) const;
     void add_task(const Identifier& taskID, const ThreadStatus status) const;
+    static void append_field(std::string& output, const std::string& field);
     Depositability can_deposit(
         const OTPayment& payment,
         const Identifier& recipient,
@@ -189,6 +245,8 @@ private:
         Identifier& serverID) const;
     void check_nym_revision(const ServerContext& context, OperationQueue& queue)
         const;
+    bool check_reply(const Identifier& serverID, const SendResult result)
+        const;
     bool check_registration(
         const Identifier& nymID,
         const Identifier& serverID,
@@ -234,26 +292,37 @@ private:
         const Identifier& serverID,
         const Identifier& targetNymID) const;
     bool finish_task(const Identifier& taskID, const bool success) const;
+    void forget_task(const Identifier& taskID) const;
     bool get_admin(
         const Identifier& nymID,
         const Identifier& serverID,
         const OTPassword& password) const;
     Identifier get_introduction_server(const Lock& lock) const;
+    bool have_capacity() const;
     UniqueQueue<Identifier>& get_nym_fetch(const Identifier& serverID) const;
     OperationQueue& get_operations(const ContextID& id) const;
     Identifier import_default_introduction_server(const Lock& lock) const;
     void load_introduction_server(const Lock& lock) const;
+    bool load_task(
+        const Identifier& nymID,
+        const Identifier& taskID,
+        PendingTask& task) const;
     bool message_nym(
         const Identifier& taskID,
         const Identifier& nymID,
         const Identifier& serverID,
         const Identifier& targetNymID,
         const std::string& text) const;
+    void persist_task(const Identifier& taskID, const PendingTask& task) const;
     bool publish_server_registration(
         const Identifier& nymID,
         const Identifier& serverID,
         const bool forcePrimary) const;
     Identifier random_id() const;
+    static bool read_field(
+        const std::string& input,
+        std::size_t& position,
+        std::string& output);
     void refresh_accounts() const;
     void refresh_contacts() const;
     bool register_account(
@@ -265,6 +334,9 @@ private:
         const Identifier& taskID,
         const Identifier& nymID,
         const Identifier& serverID) const;
+    void restore_tasks() const;
+    bool save_task(const Identifier& taskID, const PendingTask& task) const;
+    void save_task_index(const Lock& lock) const;
     Identifier schedule_download_nymbox(
         const Identifier& localNymID,
         const Identifier& serverID) const;
@@ -272,6 +344,7 @@ private:
         const Identifier& localNymID,
         const Identifier& serverID,
         const Identifier& unitID) const;
+    std::chrono::seconds server_delay(const Identifier& serverID) const;
     Identifier set_introduction_server(
         const Lock& lock,
         const ServerContract& contract) const;
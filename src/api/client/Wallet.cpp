@@ -74,8 +74,11 @@ namespace opentxs::api::client::implementation
 Wallet::Wallet(Native& ot)
     : ot_(ot)
     , nym_map_()
+    , nym_verified_()
     , server_map_()
+    , server_verified_()
     , unit_map_()
+    , unit_verified_()
     , context_map_()
     , issuer_map_()
     , nym_map_lock_()
@@ -259,6 +262,8 @@ Editor<class Context> Wallet::mutable_Context(
 
     OT_ASSERT(base);
 
+    base->begin_edit();
+
     return Editor<class Context>(base.get(), callback);
 }
 
@@ -302,6 +307,8 @@ Editor<class ClientContext> Wallet::mutable_ClientContext(
 
     OT_ASSERT(nullptr != child);
 
+    child->begin_edit();
+
     return Editor<class ClientContext>(child, callback);
 }
 
@@ -352,6 +359,8 @@ Editor<class ServerContext> Wallet::mutable_ServerContext(
 
     OT_ASSERT(nullptr != child);
 
+    child->begin_edit();
+
     return Editor<class ServerContext>(child, callback);
 }
 
@@ -363,6 +372,10 @@ void Wallet::save(class Context* context) const
 
     Lock lock(context->lock_);
 
+    // Nested editors on the same context (one per request plus any opened by
+    // the handlers it calls) are signed and saved once, by the outermost
+    if (false == context->end_edit(lock)) return;
+
     context->update_signature(lock);
 
     OT_ASSERT(context->validate(lock));
@@ -370,6 +383,22 @@ void Wallet::save(class Context* context) const
     ot_.DB().Store(context->contract(lock));
 }
 
+Identifier Wallet::digest(const proto::ServerContract& contract)
+{
+    Identifier output;
+    output.CalculateDigest(proto::ProtoAsData(contract));
+
+    return output;
+}
+
+Identifier Wallet::digest(const proto::UnitDefinition& contract)
+{
+    Identifier output;
+    output.CalculateDigest(proto::ProtoAsData(contract));
+
+    return output;
+}
+
 std::set<Identifier> Wallet::IssuerList(const Identifier& nymID) const
 {
     std::set<Identifier> output{};
@@ -509,14 +538,26 @@ ConstNym Wallet::Nym(
     } else {
         auto& pNym = nym_map_[nym].second;
         if (pNym) {
-            valid = pNym->VerifyPseudonym();
+            // Credentials only change through updates which bump the
+            // revision, so skip re-verifying the whole credential chain
+            // for a nym already verified at its current revision.
+            const auto verified = nym_verified_.find(nym);
+            valid = (nym_verified_.end() != verified) &&
+                    (verified->second == pNym->Revision());
+
+            if (false == valid) valid = pNym->VerifyPseudonym();
         }
     }
 
     if (valid) {
-        return nym_map_[nym].second;
+        auto& output = nym_map_[nym].second;
+        nym_verified_[nym] = output->Revision();
+
+        return output;
     }
 
+    nym_verified_.erase(nym);
+
     return nullptr;
 }
 
@@ -544,6 +585,7 @@ ConstNym Wallet::Nym(const proto::CredentialIndex& publicNym) const
             candidate->WriteCredentials();
             Lock mapLock(nym_map_lock_);
             nym_map_.erase(id);
+            nym_verified_.erase(id);
             mapLock.unlock();
         }
     }
@@ -1049,6 +1091,7 @@ bool Wallet::RemoveServer(const Identifier& id) const
     std::string server(String(id).Get());
     Lock mapLock(server_map_lock_);
     auto deleted = server_map_.erase(server);
+    server_verified_.erase(server);
 
     if (0 != deleted) {
         return ot_.DB().RemoveServer(server);
@@ -1062,6 +1105,7 @@ bool Wallet::RemoveUnitDefinition(const Identifier& id) const
     std::string unit(String(id).Get());
     Lock mapLock(unit_map_lock_);
     auto deleted = unit_map_.erase(unit);
+    unit_verified_.erase(unit);
 
     if (0 != deleted) {
         return ot_.DB().RemoveUnitDefinition(unit);
@@ -1099,6 +1143,7 @@ ConstServerContract Wallet::Server(
 
                 if (pServer) {
                     valid = true;  // Factory() performs validation
+                    server_verified_[server] = digest(*serialized);
                     pServer->Signable::SetAlias(alias);
                 }
             }
@@ -1129,8 +1174,17 @@ ConstServerContract Wallet::Server(
         }
     } else {
         auto& pServer = server_map_[server];
+
         if (pServer) {
-            valid = pServer->Validate();
+            valid = (0 < server_verified_.count(server));
+
+            if (false == valid) {
+                valid = pServer->Validate();
+
+                if (valid) {
+                    server_verified_[server] = digest(pServer->Contract());
+                }
+            }
         }
     }
 
@@ -1148,9 +1202,12 @@ ConstServerContract Wallet::Server(
 
     if (contract) {
         if (contract->Validate()) {
-            if (ot_.DB().Store(contract->Contract(), contract->Alias())) {
+            const auto serialized = contract->Contract();
+
+            if (ot_.DB().Store(serialized, contract->Alias())) {
                 Lock mapLock(server_map_lock_);
                 server_map_[server].reset(contract.release());
+                server_verified_[server] = digest(serialized);
                 mapLock.unlock();
             }
         }
@@ -1162,6 +1219,17 @@ ConstServerContract Wallet::Server(
 ConstServerContract Wallet::Server(const proto::ServerContract& contract) const
 {
     std::string server = contract.id();
+    const auto hash = digest(contract);
+    Lock mapLock(server_map_lock_);
+    const auto verified = server_verified_.find(server);
+
+    // Importing the contract which is already held is a no-op
+    if ((server_verified_.end() != verified) && (hash == verified->second)) {
+
+        return server_map_[server];
+    }
+
+    mapLock.unlock();
     auto nym = Nym(Identifier(contract.nymid()));
 
     if (!nym && contract.has_publicnym()) {
@@ -1175,8 +1243,9 @@ ConstServerContract Wallet::Server(const proto::ServerContract& contract) const
         if (candidate) {
             if (candidate->Validate()) {
                 if (ot_.DB().Store(candidate->Contract(), candidate->Alias())) {
-                    Lock mapLock(server_map_lock_);
+                    mapLock.lock();
                     server_map_[server].reset(candidate.release());
+                    server_verified_[server] = hash;
                     mapLock.unlock();
                 }
             }
@@ -1225,6 +1294,7 @@ bool Wallet::SetNymAlias(const Identifier& id, const std::string& alias) const
 
     if (nym_map_.end() != it) {
         nym_map_.erase(it);
+        nym_verified_.erase(String(id).Get());
     }
 
     return ot_.DB().SetNymAlias(String(id).Get(), alias);
@@ -1336,6 +1406,7 @@ const ConstUnitDefinition Wallet::UnitDefinition(
 
                 if (pUnit) {
                     valid = true;  // Factory() performs validation
+                    unit_verified_[unit] = digest(*serialized);
                     pUnit->Signable::SetAlias(alias);
                 }
             }
@@ -1365,8 +1436,15 @@ const ConstUnitDefinition Wallet::UnitDefinition(
         }
     } else {
         auto& pUnit = unit_map_[unit];
+
         if (pUnit) {
-            valid = pUnit->Validate();
+            valid = (0 < unit_verified_.count(unit));
+
+            if (false == valid) {
+                valid = pUnit->Validate();
+
+                if (valid) unit_verified_[unit] = digest(pUnit->Contract());
+            }
         }
     }
 
@@ -1384,9 +1462,12 @@ ConstUnitDefinition Wallet::UnitDefinition(
 
     if (contract) {
         if (contract->Validate()) {
-            if (ot_.DB().Store(contract->Contract(), contract->Alias())) {
+            const auto serialized = contract->Contract();
+
+            if (ot_.DB().Store(serialized, contract->Alias())) {
                 Lock mapLock(unit_map_lock_);
                 unit_map_[unit].reset(contract.release());
+                unit_verified_[unit] = digest(serialized);
                 mapLock.unlock();
             }
         }
@@ -1399,6 +1480,17 @@ ConstUnitDefinition Wallet::UnitDefinition(
     const proto::UnitDefinition& contract) const
 {
     std::string unit = contract.id();
+    const auto hash = digest(contract);
+    Lock mapLock(unit_map_lock_);
+    const auto verified = unit_verified_.find(unit);
+
+    // Importing the contract which is already held is a no-op
+    if ((unit_verified_.end() != verified) && (hash == verified->second)) {
+
+        return unit_map_[unit];
+    }
+
+    mapLock.unlock();
     auto nym = Nym(Identifier(contract.nymid()));
 
     if (!nym && contract.has_publicnym()) {
@@ -1412,8 +1504,9 @@ ConstUnitDefinition Wallet::UnitDefinition(
         if (candidate) {
             if (candidate->Validate()) {
                 if (ot_.DB().Store(candidate->Contract(), candidate->Alias())) {
-                    Lock mapLock(unit_map_lock_);
+                    mapLock.lock();
                     unit_map_[unit].reset(candidate.release());
+                    unit_verified_[unit] = hash;
                     mapLock.unlock();
                 }
             }
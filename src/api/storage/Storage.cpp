@@ -102,6 +102,8 @@ Storage::Storage(
     OT_ASSERT(multiplex_p_);
 }
 
+void Storage::BeginBatch() const { opentxs::storage::Node::BeginBatch(); }
+
 std::set<std::string> Storage::BlockchainAccountList(
     const std::string& nymID,
     const proto::ContactItemType type) const
@@ -139,6 +141,19 @@ void Storage::Cleanup() { Cleanup_Storage(); }
 
 void Storage::CollectGarbage() const { Root().Migrate(multiplex_.Primary()); }
 
+bool Storage::CommitBatch() const
+{
+    auto* tree = root();
+    Lock lock(write_lock_);
+    const bool output = opentxs::storage::Node::CommitBatch();
+
+    if (false == opentxs::storage::Node::Batching()) {
+        save(tree, lock);
+    }
+
+    return output;
+}
+
 std::string Storage::ContactAlias(const std::string& id) const
 {
     return Root().Tree().ContactNode().Alias(id);
@@ -977,6 +992,9 @@ void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
 
+    // The root is written once by CommitBatch
+    if (opentxs::storage::Node::Batching()) return;
+
     multiplex_.StoreRoot(true, in->root_);
 }
 
@@ -1498,6 +1516,17 @@ bool Storage::Store(const proto::UnitDefinition& data, const std::string& alias)
     return false;
 }
 
+bool Storage::ThreadExists(
+    const std::string& nymID,
+    const std::string& threadID) const
+{
+    auto& nyms = Root().Tree().NymNode();
+
+    if (false == nyms.Exists(nymID)) return false;
+
+    return nyms.Nym(nymID).Threads().Exists(threadID);
+}
+
 ObjectList Storage::ThreadList(const std::string& nymID, const bool unreadOnly)
     const
 {
@@ -1527,6 +1556,20 @@ ObjectList Storage::UnitDefinitionList() const
     return Root().Tree().UnitNode().List();
 }
 
+std::size_t Storage::UnreadCount(const std::string& nymId) const
+{
+    auto& nyms = Root().Tree().NymNode();
+
+    if (false == nyms.Exists(nymId)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Nym " << nymId
+              << " does not exist." << std::endl;
+
+        return 0;
+    }
+
+    return nyms.Nym(nymId).Threads().UnreadCount();
+}
+
 std::size_t Storage::UnreadCount(
     const std::string& nymId,
     const std::string& threadId) const
@@ -64,7 +64,6 @@
 
 #include <irrxml/irrXML.hpp>
 #include <stdint.h>
-#include <list>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -74,8 +73,6 @@
 namespace opentxs
 {
 
-typedef std::map<std::string, Token*> mapOfTokenPointers;
-
 bool Purse::GetNymID(Identifier& theOutput) const
 {
     bool bSuccess = false;
@@ -255,6 +252,12 @@ bool Purse::GenerateInternalKey()
 // Take all the tokens from a purse and add them to this purse.
 // Don't allow duplicates.
 //
+// The tokens already in this purse are owned by theOldNym and stay that way,
+// so their sealed envelopes are kept as-is: each one is opened once (to find
+// its spendable ID for duplicate detection) but never re-sealed. Only the
+// tokens coming from theNewPurse are reassigned, re-signed and sealed to
+// theOldNym.
+//
 bool Purse::Merge(
     const Nym& theSigner,
     OTNym_or_SymmetricKey theOldNym,  // must be private, if a nym.
@@ -263,117 +266,47 @@ bool Purse::Merge(
 {
     const char* szFunc = "Purse::Merge";
 
-    mapOfTokenPointers theMap;
-
-    while (Count() > 0) {
-        Token* pToken = Pop(theOldNym);  // must be private, if a Nym.
-        OT_ASSERT_MSG(
-            nullptr != pToken,
-            "Purse::Merge: Assert: nullptr != Pop(theOldNym) \n");
+    // Keyed by spendable ID. If the armor is not null, the token is already
+    // sealed to theOldNym and the armor is pushed back without re-sealing.
+    typedef std::pair<std::unique_ptr<OTASCIIArmor>, std::unique_ptr<Token>>
+        MergeEntry;
+    std::map<std::string, MergeEntry> theMap;
 
-        const OTASCIIArmor& ascTokenID = pToken->GetSpendable();
+    dequeOfTokens oldTokens;
+    oldTokens.swap(m_dequeTokens);
+    m_lTotalValue = 0;
 
-        std::list<mapOfTokenPointers::iterator> listOfTokenMapIterators;
+    while (!oldTokens.empty()) {
+        std::unique_ptr<OTASCIIArmor> pArmor(oldTokens.back());
+        oldTokens.pop_back();
+        OT_ASSERT(pArmor);
 
-        // I just popped a Token off of *this. Let's see if it's in my temporary
-        // map...
-        // If it's already there, then just delete it (duplicate).
-        //
-        for (auto it(theMap.begin()); it != theMap.end(); ++it) {
-            Token* pTempToken = it->second;
-            OT_ASSERT(nullptr != pTempToken);
-
-            const OTASCIIArmor& ascTempTokenID = pTempToken->GetSpendable();
-
-            // It's already there. Delete the one that's already there.
-            // (That way we can add it after, whether it was there originally or
-            // not.)
-            if (ascTempTokenID == ascTokenID) {
-                listOfTokenMapIterators.push_back(it);
-                //                theMap.erase(it);
-                //                delete pTempToken;
-                //              pTempToken = nullptr;
-                // break; // In case there are multiple duplicates, not just
-                // one.
-            }
-        }
-        while (!listOfTokenMapIterators.empty()) {
-            Token* pTempToken = (listOfTokenMapIterators.back())->second;
-            theMap.erase(listOfTokenMapIterators.back());
-            delete pTempToken;
-            pTempToken = nullptr;
-            listOfTokenMapIterators.pop_back();
-        }
+        std::unique_ptr<Token> pToken(OpenToken(*pArmor, theOldNym));
+        OT_ASSERT_MSG(
+            pToken, "Purse::Merge: Assert: nullptr != OpenToken(theOldNym) \n");
 
-        // Now we know there aren't any duplicates on the temporary map, let's
-        // add the token to it.
-        std::string theKey = ascTokenID.Get();
-        theMap.insert(std::pair<std::string, Token*>(theKey, pToken));
+        // If it's already there, replace the one that's already there
+        // (duplicate).
+        std::string theKey = pToken->GetSpendable().Get();
+        theMap[theKey] = MergeEntry(std::move(pArmor), std::move(pToken));
     }
-    // At this point, all of the tokens on *this have been popped, and added
-    // to the temporary map as token pointers, with any duplicates removed.
+    // At this point, all of the tokens on *this have been opened, and added
+    // to the temporary map with any duplicates removed.
 
-    // Basically now I just want to do the exact same thing with the other
-    // purse...
+    // Basically now I just want to do the same thing with the other purse...
     //
     while (theNewPurse.Count() > 0) {
-        Token* pToken = theNewPurse.Pop(theNewNym);
+        std::unique_ptr<Token> pToken(theNewPurse.Pop(theNewNym));
         OT_ASSERT_MSG(
-            nullptr != pToken,
+            pToken,
             "Purse::Merge: Assert: nullptr != theNewPurse.Pop(theNewNym) \n");
 
-        const OTASCIIArmor& ascTokenID = pToken->GetSpendable();
-
-        std::list<mapOfTokenPointers::iterator> listOfTokenMapIterators;
-
-        // I just popped a Token off of theNewPurse. Let's see if it's in my
-        // temporary map...
-        // If it's already there, then just delete it (it's a duplicate.)
-        for (auto it(theMap.begin()); it != theMap.end(); ++it) {
-            Token* pTempToken = it->second;
-            OT_ASSERT(nullptr != pTempToken);
-
-            const OTASCIIArmor& ascTempTokenID = pTempToken->GetSpendable();
-
-            // It's already there. Delete the one that's already there.
-            // (That way we can add it after, whether it was there originally or
-            // not.)
-            if (ascTempTokenID == ascTokenID) {
-                listOfTokenMapIterators.push_back(it);
-                //                theMap.erase(it);
-                //                delete pTempToken;
-                //              pTempToken = nullptr;
-                // break; // In case there are multiple duplicates, not just
-                // one.
-            }
-        }
-        while (!listOfTokenMapIterators.empty()) {
-            Token* pTempToken = (listOfTokenMapIterators.back())->second;
-            theMap.erase(listOfTokenMapIterators.back());
-            delete pTempToken;
-            pTempToken = nullptr;
-            listOfTokenMapIterators.pop_back();
-        }
-        // Now we KNOW there aren't any duplicates on the temporary map, so
-        // let's
-        // add the token to it...
-        //
-        std::string theKey = ascTokenID.Get();
-        theMap.insert(std::pair<std::string, Token*>(theKey, pToken));
-
         //
         // SINCE THE new purse is being MERGED into the old purse, we don't have
-        // to re-assign ownership
-        // of any of the old tokens. But we DO need to re-assign ownership of
-        // the NEW tokens that are being
-        // merged in. We reassign them from New ==> TO OLD. (And we only bother
-        // if they aren't the same Nym.)
-        //
-        //      if (!theNewNym.CompareID(theOldNym)) // Not the same
-        // Nym!!
-        //
-        // UPDATE: the above line was moved INSIDE OTToken::ReassignOwnership,
-        // FYI.
+        // to re-assign ownership of any of the old tokens. But we DO need to
+        // re-assign ownership of the NEW tokens that are being merged in. We
+        // reassign them from New ==> TO OLD. (OTToken::ReassignOwnership only
+        // bothers if they aren't the same Nym.)
         //
         if (false ==
             pToken->ReassignOwnership(
@@ -390,23 +323,32 @@ bool Purse::Merge(
             pToken->SignContract(theSigner);
             pToken->SaveContract();
         }
+
+        std::string theKey = pToken->GetSpendable().Get();
+        theMap[theKey] = MergeEntry(nullptr, std::move(pToken));
     }
 
     // At this point, all of the tokens on *this (old purse) AND theNewPurse
-    // have been popped, and added
-    // to the temporary map as token pointers, with any duplicates removed.
-    // Also, the tokens on the New Purse have been reassigned (from theNewNym as
-    // owner, to theOldNym as
-    // owner) and each has been signed and saved properly, using the old Nym.
+    // are in the temporary map, with any duplicates removed. The tokens from
+    // the New Purse have been reassigned (from theNewNym as owner, to
+    // theOldNym as owner) and each has been signed and saved properly, using
+    // the old Nym.
 
-    // Next, we loop through theMap, and Push ALL of those tokens back onto
+    // Next, we loop through theMap, and put ALL of those tokens back onto
     // *this. (The old purse.)
 
     bool bSuccess = true;
 
     for (auto& it : theMap) {
-        Token* pToken = it.second;
-        OT_ASSERT(nullptr != pToken);
+        auto& pArmor = it.second.first;
+        auto& pToken = it.second.second;
+        OT_ASSERT(pToken);
+
+        if (pArmor) {
+            PushSealed(pArmor.release(), *pToken);
+
+            continue;
+        }
 
         bool bPush = Push(
             theOldNym,  // can be public, if a Nym.
@@ -422,19 +364,6 @@ bool Purse::Merge(
         // Maybe shouldn't? Seems right somehow.
     }
 
-    // Next I clean up all the tokens out of the temporary map, since they will
-    // leak otherwise.
-    //
-    while (!theMap.empty()) {
-        Token* pToken = theMap.begin()->second;
-        OT_ASSERT(nullptr != pToken);
-
-        delete pToken;
-        pToken = nullptr;
-
-        theMap.erase(theMap.begin());
-    }
-
     // Note: Caller needs to re-sign and re-save this purse, since we aren't
     // doing it
     // internally here.
@@ -972,7 +901,7 @@ void Purse::UpdateContents()  // Before transmission or serialization, this is
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 int32_t Purse::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
@@ -1330,9 +1259,19 @@ Token* Purse::Peek(OTNym_or_SymmetricKey theOwner) const
     // Grab a pointer to the first armored token on the deque.
     //
     const OTASCIIArmor* pArmor = m_dequeTokens.front();
-    // ---------------
+    OT_ASSERT(nullptr != pArmor);
+
+    return OpenToken(*pArmor, theOwner);
+}
+
+// Caller IS responsible to delete.
+//
+Token* Purse::OpenToken(
+    const OTASCIIArmor& theArmor,
+    OTNym_or_SymmetricKey& theOwner) const
+{
     // Copy the token contents into an Envelope.
-    OTEnvelope theEnvelope(*pArmor);
+    OTEnvelope theEnvelope(theArmor);
 
     // Open the envelope into a string.
     //
@@ -1492,31 +1431,7 @@ bool Purse::Push(OTNym_or_SymmetricKey theOwner, const Token& theToken)
             theOwner.Seal_or_Encrypt(theEnvelope, strToken, &strDisplay);
 
         if (bSuccess) {
-            OTASCIIArmor* pArmor = new OTASCIIArmor(theEnvelope);
-
-            m_dequeTokens.push_front(pArmor);
-
-            // We keep track of the purse's total value.
-            m_lTotalValue += theToken.GetDenomination();
-
-            // We keep track of the expiration dates for the purse, based on the
-            // tokens within.
-            //
-            if (m_tLatestValidFrom < theToken.GetValidFrom()) {
-                m_tLatestValidFrom = theToken.GetValidFrom();
-            }
-
-            if ((OT_TIME_ZERO == m_tEarliestValidTo) ||
-                (m_tEarliestValidTo > theToken.GetValidTo())) {
-                m_tEarliestValidTo = theToken.GetValidTo();
-            }
-
-            if (m_tLatestValidFrom > m_tEarliestValidTo)
-                otErr << __FUNCTION__
-                      << ": WARNING: This purse has a 'valid from' date LATER "
-                         "than the 'valid to' date. "
-                         "(due to different tokens with different date "
-                         "ranges...)\n";
+            PushSealed(new OTASCIIArmor(theEnvelope), theToken);
 
             return true;
         } else {
@@ -1542,6 +1457,37 @@ bool Purse::Push(OTNym_or_SymmetricKey theOwner, const Token& theToken)
     return false;
 }
 
+// Takes ownership of pArmor, which must already contain theToken sealed to
+// the owner of this purse.
+void Purse::PushSealed(OTASCIIArmor* pArmor, const Token& theToken)
+{
+    OT_ASSERT(nullptr != pArmor);
+
+    m_dequeTokens.push_front(pArmor);
+
+    // We keep track of the purse's total value.
+    m_lTotalValue += theToken.GetDenomination();
+
+    // We keep track of the expiration dates for the purse, based on the
+    // tokens within.
+    //
+    if (m_tLatestValidFrom < theToken.GetValidFrom()) {
+        m_tLatestValidFrom = theToken.GetValidFrom();
+    }
+
+    if ((OT_TIME_ZERO == m_tEarliestValidTo) ||
+        (m_tEarliestValidTo > theToken.GetValidTo())) {
+        m_tEarliestValidTo = theToken.GetValidTo();
+    }
+
+    if (m_tLatestValidFrom > m_tEarliestValidTo)
+        otErr << __FUNCTION__
+              << ": WARNING: This purse has a 'valid from' date LATER "
+                 "than the 'valid to' date. "
+                 "(due to different tokens with different date "
+                 "ranges...)\n";
+}
+
 int32_t Purse::Count() const
 {
     return static_cast<int32_t>(m_dequeTokens.size());
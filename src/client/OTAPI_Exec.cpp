@@ -104,6 +104,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define OT_METHOD "opentxs::OTAPI_Exec::"
 
@@ -618,20 +619,8 @@ std::string OTAPI_Exec::CreateNymHD(
     const std::uint32_t index) const
 {
 #if OT_CRYPTO_SUPPORTED_KEY_HD
-    switch (type) {
-        case proto::CITEMTYPE_INDIVIDUAL:
-        case proto::CITEMTYPE_ORGANIZATION:
-        case proto::CITEMTYPE_BUSINESS:
-        case proto::CITEMTYPE_GOVERNMENT:
-        case proto::CITEMTYPE_SERVER: {
-            break;
-        }
-        default: {
-            otOut << OT_METHOD << __FUNCTION__ << ": Invalid nym type."
-                  << std::endl;
-
-            return {};
-        }
+    if (false == valid_nym_type(type)) {
+        return {};
     }
 
     OTWallet* pWallet = ot_api_.GetWallet(__FUNCTION__);
@@ -640,6 +629,63 @@ std::string OTAPI_Exec::CreateNymHD(
         return {};
     }
 
+    const auto id = create_nym_hd(type, name, fingerprint, index);
+
+    if (false == id.empty()) {
+        pWallet->SaveWallet();
+    }
+
+    return id;
+#else
+    otOut << OT_METHOD << __FUNCTION__ << ": No support for HD key derivation."
+          << std::endl;
+
+    return {};
+#endif
+}
+
+std::vector<std::string> OTAPI_Exec::CreateNymsHD(
+    const proto::ContactItemType type,
+    const std::vector<std::string>& names,
+    const std::string& fingerprint) const
+{
+    std::vector<std::string> output{};
+#if OT_CRYPTO_SUPPORTED_KEY_HD
+    if (false == valid_nym_type(type)) {
+        return output;
+    }
+
+    OTWallet* pWallet = ot_api_.GetWallet(__FUNCTION__);
+
+    if (nullptr == pWallet) {
+        return output;
+    }
+
+    bool created{false};
+
+    for (const auto& name : names) {
+        output.emplace_back(create_nym_hd(type, name, fingerprint, 0));
+        created |= (false == output.back().empty());
+    }
+
+    if (created) {
+        pWallet->SaveWallet();
+    }
+#else
+    otOut << OT_METHOD << __FUNCTION__ << ": No support for HD key derivation."
+          << std::endl;
+#endif
+
+    return output;
+}
+
+#if OT_CRYPTO_SUPPORTED_KEY_HD
+std::string OTAPI_Exec::create_nym_hd(
+    const proto::ContactItemType type,
+    const std::string& name,
+    const std::string& fingerprint,
+    const std::uint32_t index) const
+{
     NymParameters nymParameters(proto::CREDTYPE_HD);
 
     if (0 < fingerprint.size()) {
@@ -647,7 +693,7 @@ std::string OTAPI_Exec::CreateNymHD(
     }
 
     nymParameters.SetNym(index);
-    Nym* pNym = ot_api_.CreateNym(nymParameters);
+    Nym* pNym = ot_api_.CreateNym(nymParameters, false);
 
     if (nullptr == pNym) {
         otOut << OT_METHOD << __FUNCTION__ << ": Failed trying to create Nym."
@@ -679,16 +725,29 @@ std::string OTAPI_Exec::CreateNymHD(
 
     pNym->SetAlias(name);
     pNym->SaveSignedNymfile(*pSignerNym);
-    pWallet->SaveWallet();
     contacts_.NewContact(name, pNym->ID(), PaymentCode(pNym->PaymentCode()));
 
     return id;
-#else
-    otOut << OT_METHOD << __FUNCTION__ << ": No support for HD key derivation."
-          << std::endl;
-
-    return {};
+}
 #endif
+
+bool OTAPI_Exec::valid_nym_type(const proto::ContactItemType type)
+{
+    switch (type) {
+        case proto::CITEMTYPE_INDIVIDUAL:
+        case proto::CITEMTYPE_ORGANIZATION:
+        case proto::CITEMTYPE_BUSINESS:
+        case proto::CITEMTYPE_GOVERNMENT:
+        case proto::CITEMTYPE_SERVER: {
+            return true;
+        }
+        default: {
+            otOut << OT_METHOD << __FUNCTION__ << ": Invalid nym type."
+                  << std::endl;
+        }
+    }
+
+    return false;
 }
 
 std::string OTAPI_Exec::GetNym_ActiveCronItemIDs(
@@ -1795,25 +1854,16 @@ bool OTAPI_Exec::Wallet_CanRemoveServer(const std::string& NOTARY_ID) const
         "OTAPI_Exec::Wallet_CanRemoveServer: Null NOTARY_ID passed in.");
 
     Identifier theID(NOTARY_ID);
-    const int32_t& nCount = OTAPI_Exec::GetAccountCount();
-
-    // Loop through all the accounts.
-    for (int32_t i = 0; i < nCount; i++) {
-        std::string pAcctID = OTAPI_Exec::GetAccountWallet_ID(i);
-        String strAcctID(pAcctID);
+    const auto accounts = ot_api_.Accounts({}, theID, {});
 
-        std::string pID =
-            OTAPI_Exec::GetAccountWallet_NotaryID(strAcctID.Get());
-        Identifier theCompareID(pID);
-
-        if (theID == theCompareID) {
-            otOut << OT_METHOD << __FUNCTION__
-                  << ": Unable to remove server contract " << NOTARY_ID
-                  << " from "
-                     "wallet, because Account "
-                  << strAcctID << " uses it.\n";
-            return false;
-        }
+    if (false == accounts.empty()) {
+        String strAcctID(*accounts.begin());
+        otOut << OT_METHOD << __FUNCTION__
+              << ": Unable to remove server contract " << NOTARY_ID
+              << " from "
+                 "wallet, because Account "
+              << strAcctID << " uses it.\n";
+        return false;
     }
     const int32_t& nNymCount = OTAPI_Exec::GetNymCount();
 
@@ -1900,25 +1950,16 @@ bool OTAPI_Exec::Wallet_CanRemoveAssetType(
         "passed in.");
 
     Identifier theID(INSTRUMENT_DEFINITION_ID);
-    const int32_t& nCount = GetAccountCount();
+    const auto accounts = ot_api_.Accounts({}, {}, theID);
 
-    // Loop through all the accounts.
-    for (int32_t i = 0; i < nCount; i++) {
-        std::string pAcctID = GetAccountWallet_ID(i);
-        String strAcctID(pAcctID);
-
-        std::string pID =
-            GetAccountWallet_InstrumentDefinitionID(strAcctID.Get());
-        Identifier theCompareID(pID);
-
-        if (theID == theCompareID) {
-            otOut << OT_METHOD << __FUNCTION__
-                  << ": Unable to remove asset contract "
-                  << INSTRUMENT_DEFINITION_ID << " from "
-                                                 "wallet: Account "
-                  << strAcctID << " uses it.\n";
-            return false;
-        }
+    if (false == accounts.empty()) {
+        String strAcctID(*accounts.begin());
+        otOut << OT_METHOD << __FUNCTION__
+              << ": Unable to remove asset contract "
+              << INSTRUMENT_DEFINITION_ID << " from "
+                                             "wallet: Account "
+              << strAcctID << " uses it.\n";
+        return false;
     }
     return true;
 }
@@ -3926,6 +3967,19 @@ std::string OTAPI_Exec::GetAccountWallet_ID(const int32_t& nIndex) const
     return {};
 }
 
+std::set<Identifier> OTAPI_Exec::GetAccountWallet_List(
+    const std::string& NYM_ID,
+    const std::string& NOTARY_ID,
+    const std::string& INSTRUMENT_DEFINITION_ID) const
+{
+    std::lock_guard<std::recursive_mutex> lock(lock_);
+
+    return ot_api_.Accounts(
+        Identifier(NYM_ID),
+        Identifier(NOTARY_ID),
+        Identifier(INSTRUMENT_DEFINITION_ID));
+}
+
 // returns the account name, based on account ID.
 std::string OTAPI_Exec::GetAccountWallet_Name(const std::string& THE_ID) const
 {
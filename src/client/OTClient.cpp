@@ -6139,13 +6139,12 @@ bool OTClient::processServerReply(
 
     Message& theReply = *reply;
     const String serverID(context.Server());
-    const auto& serverNym = context.RemoteNym();
     const Identifier accountID(theReply.m_strAcctID);
 
     // Just like the server verifies all messages before processing them,
     // so does the client need to verify the signatures against each message
     // and verify the various contract IDs and signatures.
-    if (!theReply.VerifySignature(serverNym)) {
+    if (!context.VerifyReply(theReply)) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Error: Server reply signature failed to verify."
               << std::endl;
@@ -71,11 +71,14 @@
 
 #include <stdint.h>
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -95,6 +98,9 @@ OTWallet::OTWallet(
     , m_strDataFolder(OTDataFolder::Get())
     , m_mapPrivateNyms()
     , m_mapAccounts()
+    , m_mapAccountsByNym()
+    , m_mapAccountsByServer()
+    , m_mapAccountsByUnit()
     , m_mapExtraKeys()
     , m_setNymsOnCachedKey()
 {
@@ -104,6 +110,9 @@ void OTWallet::release(const Lock&)
 {
     m_mapPrivateNyms.clear();
     m_mapAccounts.clear();
+    m_mapAccountsByNym.clear();
+    m_mapAccountsByServer.clear();
+    m_mapAccountsByUnit.clear();
     m_mapExtraKeys.clear();
 }
 
@@ -201,7 +210,9 @@ std::string OTWallet::ImportSeed(
 
 // No need to delete Nym returned by this function.
 // (Wallet stores it in RAM and will delete when it destructs.)
-Nym* OTWallet::CreateNym(const NymParameters& nymParameters)
+Nym* OTWallet::CreateNym(
+    const NymParameters& nymParameters,
+    const bool saveWallet)
 {
     Lock lock(lock_);
     std::unique_ptr<Nym> pNym(new Nym(nymParameters));
@@ -222,7 +233,7 @@ Nym* OTWallet::CreateNym(const NymParameters& nymParameters)
             otErr << __FUNCTION__
                   << ": Error: Failed in convert_nym_to_cached_key.\n";
 
-        save_wallet(lock);
+        if (saveWallet) save_wallet(lock);
 
         // By this point, pNym is a good pointer, and is on the wallet.
         //  (No need to cleanup.)
@@ -452,6 +463,7 @@ void OTWallet::add_account(const Lock& lock, const Account& theAcct)
             const_cast<Account&>(theAcct).SetName(name);
         }
 
+        unindex_account(lock, ACCOUNT_ID, existing->second);
         m_mapAccounts.erase(existing);
     }
 
@@ -461,6 +473,7 @@ void OTWallet::add_account(const Lock& lock, const Account& theAcct)
     serverID = theAcct.GetPurportedNotaryID();
     unitID = theAcct.GetInstrumentDefinitionID();
     account.reset(const_cast<Account*>(&theAcct));
+    index_account(lock, ACCOUNT_ID, entry);
 }
 
 void OTWallet::AddAccount(const Account& theAcct)
@@ -538,16 +551,17 @@ Account* OTWallet::GetAccountPartialMatch(std::string PARTIAL_ID)
 Account* OTWallet::GetIssuerAccount(const Identifier& theInstrumentDefinitionID)
 {
     Lock lock(lock_);
-    // loop through the accounts and find one with a specific instrument
-    // definition ID. (And with the issuer type set.)
-    for (auto& it : m_mapAccounts) {
-        auto& pIssuerAccount = std::get<3>(it.second);
+    // loop through the accounts with a specific instrument definition ID and
+    // find one with the issuer type set.
+    const auto& accounts =
+        accounts_by(lock, m_mapAccountsByUnit, theInstrumentDefinitionID);
+
+    for (const auto& accountID : accounts) {
+        auto& pIssuerAccount = std::get<3>(m_mapAccounts.at(accountID));
 
         OT_ASSERT(pIssuerAccount);
 
-        if ((pIssuerAccount->GetInstrumentDefinitionID() ==
-             theInstrumentDefinitionID) &&
-            (pIssuerAccount->IsIssuer())) {
+        if (pIssuerAccount->IsIssuer()) {
 
             return pIssuerAccount.get();
         }
@@ -874,8 +888,17 @@ bool OTWallet::remove_nym(
 bool OTWallet::RemoveAccount(const Identifier& theTargetID)
 {
     Lock lock(lock_);
+    auto it = m_mapAccounts.find(theTargetID);
+
+    if (m_mapAccounts.end() == it) {
+
+        return false;
+    }
 
-    return (1 == m_mapAccounts.erase(theTargetID));
+    unindex_account(lock, theTargetID, it->second);
+    m_mapAccounts.erase(it);
+
+    return true;
 }
 
 bool OTWallet::save_contract(const Lock& lock, String& strContract)
@@ -972,7 +995,7 @@ bool OTWallet::save_contract(const Lock& lock, String& strContract)
     std::string str_result;
     tag.output(str_result);
 
-    strContract.Concatenate("%s", str_result.c_str());
+    strContract.Concatenate(str_result);
 
     return true;
 }
@@ -1684,6 +1707,113 @@ std::set<AccountInfo> OTWallet::AccountList() const
     return output;
 }
 
+std::set<Identifier> OTWallet::AccountList(
+    const Identifier& nymID,
+    const Identifier& serverID,
+    const Identifier& unitID) const
+{
+    std::set<Identifier> output{};
+    std::vector<const std::set<Identifier>*> filters{};
+
+    Lock lock(lock_);
+
+    if (false == nymID.empty()) {
+        filters.emplace_back(&accounts_by(lock, m_mapAccountsByNym, nymID));
+    }
+
+    if (false == serverID.empty()) {
+        filters.emplace_back(
+            &accounts_by(lock, m_mapAccountsByServer, serverID));
+    }
+
+    if (false == unitID.empty()) {
+        filters.emplace_back(&accounts_by(lock, m_mapAccountsByUnit, unitID));
+    }
+
+    if (filters.empty()) {
+        for (const auto& it : m_mapAccounts) {
+            output.emplace(it.first);
+        }
+
+        return output;
+    }
+
+    // Walk the narrowest index and check the others for membership
+    const auto* smallest = *std::min_element(
+        filters.begin(),
+        filters.end(),
+        [](const std::set<Identifier>* lhs,
+           const std::set<Identifier>* rhs) -> bool {
+            return lhs->size() < rhs->size();
+        });
+
+    for (const auto& accountID : *smallest) {
+        bool match{true};
+
+        for (const auto* filter : filters) {
+            match &= (0 < filter->count(accountID));
+        }
+
+        if (match) {
+            output.emplace(accountID);
+        }
+    }
+
+    return output;
+}
+
+const std::set<Identifier>& OTWallet::accounts_by(
+    const Lock& lock,
+    const mapOfAccountIndex& index,
+    const Identifier& id) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    static const std::set<Identifier> empty{};
+    const auto it = index.find(id);
+
+    if (index.end() == it) {
+
+        return empty;
+    }
+
+    return it->second;
+}
+
+void OTWallet::index_account(
+    const Lock& lock,
+    const Identifier& accountID,
+    const AccountEntry& entry)
+{
+    OT_ASSERT(verify_lock(lock))
+
+    m_mapAccountsByNym[std::get<0>(entry)].emplace(accountID);
+    m_mapAccountsByServer[std::get<1>(entry)].emplace(accountID);
+    m_mapAccountsByUnit[std::get<2>(entry)].emplace(accountID);
+}
+
+void OTWallet::unindex_account(
+    const Lock& lock,
+    const Identifier& accountID,
+    const AccountEntry& entry)
+{
+    OT_ASSERT(verify_lock(lock))
+
+    auto remove = [&](mapOfAccountIndex& index, const Identifier& id) {
+        auto it = index.find(id);
+
+        if (index.end() == it) return;
+
+        it->second.erase(accountID);
+
+        if (it->second.empty()) index.erase(it);
+    };
+
+    remove(m_mapAccountsByNym, std::get<0>(entry));
+    remove(m_mapAccountsByServer, std::get<1>(entry));
+    remove(m_mapAccountsByUnit, std::get<2>(entry));
+}
+
 OTWallet::~OTWallet()
 {
     Lock lock(lock_);
@@ -161,6 +161,7 @@ extern "C" {
 #define CLIENT_MASTER_KEY_TIMEOUT_DEFAULT 300
 #define CLIENT_WALLET_FILENAME "wallet.xml"
 #define CLIENT_USE_SYSTEM_KEYRING false
+#define CLIENT_MESSAGE_SESSIONS false
 #define CLIENT_PID_FILENAME "ot.pid"
 // -------------------------------------------------------
 #define OT_METHOD "opentxs::OT_API::"
@@ -768,6 +769,25 @@ bool OT_API::LoadConfigFile()
 #endif
     }
 
+    // Message Sessions
+    {
+        const char* szComment =
+            "; message_sessions authenticates read-only requests to a server, "
+            "and the server's replies, with a MAC under a key negotiated in a "
+            "signed handshake instead of signing every message.\n"
+            "; Transactions and balance agreements are always signed.\n";
+
+        bool bValue = false, bIsNewKey = false;
+        config_.CheckSet_bool(
+            "security",
+            "message_sessions",
+            CLIENT_MESSAGE_SESSIONS,
+            bValue,
+            bIsNewKey,
+            szComment);
+        ServerContext::SetSessions(bValue);
+    }
+
     // Done Loading... Lets save any changes...
     if (!config_.Save()) {
         otErr << OT_METHOD << __FUNCTION__
@@ -890,6 +910,18 @@ std::set<AccountInfo> OT_API::Accounts() const
     return wallet->AccountList();
 }
 
+std::set<Identifier> OT_API::Accounts(
+    const Identifier& nymID,
+    const Identifier& serverID,
+    const Identifier& unitID) const
+{
+    auto wallet = GetWallet(__FUNCTION__);
+
+    OT_ASSERT(nullptr != wallet)
+
+    return wallet->AccountList(nymID, serverID, unitID);
+}
+
 int32_t OT_API::GetAccountCount() const
 {
     OTWallet* pWallet =
@@ -1035,7 +1067,9 @@ Account* OT_API::GetAccountPartialMatch(
 //
 // Adds to wallet. (No need to delete.)
 //
-Nym* OT_API::CreateNym(const NymParameters& nymParameters) const
+Nym* OT_API::CreateNym(
+    const NymParameters& nymParameters,
+    const bool saveWallet) const
 {
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -1044,7 +1078,7 @@ Nym* OT_API::CreateNym(const NymParameters& nymParameters) const
 
     // By this point, pWallet is a good pointer.  (No need to cleanup.)
     Nym* nymfile = nullptr;
-    nymfile = pWallet->CreateNym(nymParameters);
+    nymfile = pWallet->CreateNym(nymParameters, saveWallet);
 
     // No need to delete nymfile. (Wallet owns.)
     return nymfile;
@@ -1234,26 +1268,15 @@ bool OT_API::Wallet_CanRemoveServer(const Identifier& NOTARY_ID) const
         OT_FAIL;
     }
     String strName;
-    const std::int32_t nCount = GetAccountCount();
+    const auto accounts = Accounts({}, NOTARY_ID, {});
 
-    // Loop through all the accounts.
-    for (std::int32_t i = 0; i < nCount; i++) {
-        Identifier accountID;
-
-        GetAccount(i, accountID, strName);
-        Account* account = GetAccount(accountID, __FUNCTION__);
-
-        Identifier purportedNotaryID(account->GetPurportedNotaryID());
-
-        if (NOTARY_ID == purportedNotaryID) {
-            String strPurportedNotaryID(purportedNotaryID),
-                strNOTARY_ID(NOTARY_ID);
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Unable to remove server contract " << strNOTARY_ID
-                  << " from wallet, because Account " << strPurportedNotaryID
-                  << " uses it.\n";
-            return false;
-        }
+    if (false == accounts.empty()) {
+        String strAccountID(*accounts.begin()), strNOTARY_ID(NOTARY_ID);
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to remove server contract " << strNOTARY_ID
+              << " from wallet, because Account " << strAccountID
+              << " uses it.\n";
+        return false;
     }
 
     const std::int32_t nNymCount = GetNymCount();
@@ -1296,27 +1319,17 @@ bool OT_API::Wallet_CanRemoveAssetType(
               << ": Null: INSTRUMENT_DEFINITION_ID passed in!\n";
         OT_FAIL;
     }
-    String strName;
-    const std::int32_t nCount = GetAccountCount();
-
-    // Loop through all the accounts.
-    for (std::int32_t i = 0; i < nCount; i++) {
-        Identifier accountID;
-
-        GetAccount(i, accountID, strName);
-        Account* account = GetAccount(accountID, __FUNCTION__);
-        Identifier theTYPE_ID(account->GetInstrumentDefinitionID());
+    const auto accounts = Accounts({}, {}, INSTRUMENT_DEFINITION_ID);
 
-        if (INSTRUMENT_DEFINITION_ID == theTYPE_ID) {
-            String strINSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID),
-                strTYPE_ID(theTYPE_ID);
+    if (false == accounts.empty()) {
+        String strINSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID),
+            strAccountID(*accounts.begin());
 
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Unable to remove asset contract "
-                  << strINSTRUMENT_DEFINITION_ID << " from wallet: Account "
-                  << strTYPE_ID << " uses it.\n";
-            return false;
-        }
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to remove asset contract "
+              << strINSTRUMENT_DEFINITION_ID << " from wallet: Account "
+              << strAccountID << " uses it.\n";
+        return false;
     }
     return true;
 }
@@ -1345,31 +1358,12 @@ bool OT_API::Wallet_CanRemoveNym(const Identifier& NYM_ID) const
     // Make sure the Nym doesn't have any accounts in the wallet.
     // (Client must close those before calling this.)
     //
-    const std::int32_t nCount = GetAccountCount();
-
-    // Loop through all the accounts.
-    for (std::int32_t i = 0; i < nCount; i++) {
-        Identifier accountID;
-        String strName;
-
-        GetAccount(i, accountID, strName);
-        Account* account = GetAccount(accountID, __FUNCTION__);
-        Identifier theNYM_ID(account->GetNymID());
-
-        if (theNYM_ID.IsEmpty()) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Bug in OT_API_Wallet_CanRemoveNym / "
-                     "OT_API_GetAccountWallet_NymID\n";
-            return false;
-        }
-
-        // Looks like the Nym still has some accounts in this wallet.
-        if (NYM_ID == theNYM_ID) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Nym cannot be removed because there are "
-                     "still accounts in the wallet for that Nym.\n";
-            return false;
-        }
+    // Looks like the Nym still has some accounts in this wallet.
+    if (false == Accounts(NYM_ID, {}, {}).empty()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Nym cannot be removed because there are "
+                 "still accounts in the wallet for that Nym.\n";
+        return false;
     }
 
     // Make sure the Nym isn't registered at any servers...
@@ -3305,9 +3299,12 @@ bool OT_API::SmartContract_ConfirmParty(
     pMessage->SignContract(*nymfile);
     pMessage->SaveContract();
 
-    nymfile->AddOutpayments(
-        *pMessage);  // Now the Nym is responsible to delete it.
-                     // It's in his "outpayments".
+    // Now the Nym is responsible to delete it. It's in his "outpayments".
+    if (false == nymfile->AddOutpayments(*pMessage)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to store outpayment separately." << std::endl;
+    }
+
     Nym* pSignerNym = nymfile;
     nymfile->SaveSignedNymfile(*pSignerNym);
 
@@ -4741,9 +4738,12 @@ Cheque* OT_API::WriteCheque(
     pMessage->SignContract(*nymfile);
     pMessage->SaveContract();
 
-    nymfile->AddOutpayments(
-        *pMessage);  // Now the Nym is responsible to delete it.
-                     // It's in his "outpayments".
+    // Now the Nym is responsible to delete it. It's in his "outpayments".
+    if (false == nymfile->AddOutpayments(*pMessage)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to store outpayment separately." << std::endl;
+    }
+
     Nym* pSignerNym = nymfile;
     nymfile->SaveSignedNymfile(*pSignerNym);
 
@@ -4976,9 +4976,12 @@ OTPaymentPlan* OT_API::ProposePaymentPlan(
     pMessage->SignContract(*nymfile);
     pMessage->SaveContract();
 
-    nymfile->AddOutpayments(
-        *pMessage);  // Now the Nym is responsible to delete it.
-                     // It's in his "outpayments".
+    // Now the Nym is responsible to delete it. It's in his "outpayments".
+    if (false == nymfile->AddOutpayments(*pMessage)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to store outpayment separately." << std::endl;
+    }
+
     Nym* pSignerNym = nymfile;
     nymfile->SaveSignedNymfile(*pSignerNym);
     return pPlan;
@@ -5085,9 +5088,12 @@ bool OT_API::ConfirmPaymentPlan(
     pMessage->SignContract(*nymfile);
     pMessage->SaveContract();
 
-    nymfile->AddOutpayments(
-        *pMessage);  // Now the Nym is responsible to delete it.
-                     // It's in his "outpayments".
+    // Now the Nym is responsible to delete it. It's in his "outpayments".
+    if (false == nymfile->AddOutpayments(*pMessage)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to store outpayment separately." << std::endl;
+    }
+
     Nym* pSignerNym = nymfile;
     nymfile->SaveSignedNymfile(*pSignerNym);
     return true;
@@ -12710,7 +12716,15 @@ CommandResult OT_API::sendNymInstrument(
                     pMessageLocalCopy->SignContract(nym);
                     pMessageLocalCopy->SaveContract();
                     auto nymfile = context.mutable_Nymfile(__FUNCTION__);
-                    nymfile.It().AddOutpayments(*(pMessageLocalCopy.release()));
+                    const bool stored = nymfile.It().AddOutpayments(
+                        *(pMessageLocalCopy.release()));
+
+                    if (false == stored) {
+                        otErr << OT_METHOD << __FUNCTION__
+                              << ": Failed to store outpayment separately."
+                              << std::endl;
+                    }
+
                     bSendIt = true;
                 }
             }
@@ -12757,7 +12771,14 @@ CommandResult OT_API::sendNymInstrument(
         pMessageLocalCopy->SignContract(nym);
         pMessageLocalCopy->SaveContract();
         auto nymfile = context.mutable_Nymfile(__FUNCTION__);
-        nymfile.It().AddOutpayments(*(pMessageLocalCopy.release()));
+        const bool stored =
+            nymfile.It().AddOutpayments(*(pMessageLocalCopy.release()));
+
+        if (false == stored) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to store outpayment separately." << std::endl;
+        }
+
         status = SendResult::UNNECESSARY;
     }
 
@@ -13335,6 +13356,94 @@ bool OT_API::Ledger_FinalizeResponse(
         accountID, context.It(), responseLedger, *inbox);
 }
 
+// Bulk version of Ledger_CreateResponse, Transaction_CreateResponse and
+// Ledger_FinalizeResponse. The inbox is loaded (and its box receipts with it)
+// once, and the same inbox is used for the balance agreement.
+//
+OT_API::ProcessInbox OT_API::Ledger_AcceptReceipts(
+    const Identifier& theNotaryID,
+    const Identifier& theNymID,
+    const Identifier& accountID,
+    const std::set<std::int32_t>& indices,
+    const std::function<bool(const OTTransaction&)>& filter) const
+{
+    OT_VERIFY_OT_ID(theNotaryID);
+    OT_VERIFY_OT_ID(theNymID);
+    OT_VERIFY_OT_ID(accountID);
+
+    rLock lock(lock_);
+    auto context = wallet_.mutable_ServerContext(theNymID, theNotaryID);
+    auto response = CreateProcessInbox(accountID, context.It());
+    auto& processInbox = std::get<0>(response);
+    auto& inbox = std::get<1>(response);
+
+    if (false == bool(processInbox) || false == bool(inbox)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to create response ledger." << std::endl;
+
+        return {};
+    }
+
+    const auto count = inbox->GetTransactionCount();
+
+    for (const auto& index : indices) {
+        if ((0 > index) || (count <= index)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Index " << index
+                  << " is out of range for an inbox of " << count
+                  << " receipts." << std::endl;
+
+            return {};
+        }
+    }
+
+    const auto numbers =
+        inbox->GetTransactionNums(indices.empty() ? nullptr : &indices);
+    std::size_t accepted{0};
+
+    for (const auto& number : numbers) {
+        OTTransaction* receipt = inbox->GetTransaction(number);
+
+        if ((nullptr != receipt) && receipt->IsAbbreviated()) {
+            inbox->LoadBoxReceipt(number);
+            receipt = inbox->GetTransaction(number);
+        }
+
+        if ((nullptr == receipt) || receipt->IsAbbreviated()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Unable to load full receipt " << number << std::endl;
+
+            return {};
+        }
+
+        if (filter && (false == filter(*receipt))) continue;
+
+        const bool responded = IncludeResponse(
+            accountID, true, context.It(), *receipt, *processInbox);
+
+        if (false == responded) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to include response to receipt " << number
+                  << std::endl;
+
+            return {};
+        }
+
+        ++accepted;
+    }
+
+    if (0 == accepted) return response;
+
+    if (false ==
+        FinalizeProcessInbox(accountID, context.It(), *processInbox, *inbox)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to finalize response."
+              << std::endl;
+
+        return {};
+    }
+
+    return response;
+}
+
 // PROBLEM: How can I put anything in an "out" box (ledger) when I can't
 // generate a
 // transaction number on the client side?  Normally I download the outbox and
@@ -13439,6 +13548,10 @@ NetworkReplyMessage OT_API::send_message(
 {
     rLock lock(lock_);
 
+    // Replies are processed while the API lock is held. Callers above this
+    // one (ServerAction, OT_ME, OTAPI_Exec) hold the same recursive lock, so
+    // it cannot be released here, and reply processing replaces wallet
+    // objects that other API calls use through raw pointers under this lock.
     m_pClient->QueueOutgoingMessage(message);
     auto result = context.Connection().Send(message);
 
@@ -894,6 +894,14 @@ std::string SwigWrap::CreateBusinessNym(
         proto::CITEMTYPE_BUSINESS, name, seed, index);
 }
 
+std::vector<std::string> SwigWrap::CreateIndividualNyms(
+    const std::vector<std::string>& names,
+    const std::string& seed)
+{
+    return OT::App().API().Exec().CreateNymsHD(
+        proto::CITEMTYPE_INDIVIDUAL, names, seed);
+}
+
 std::string SwigWrap::GetNym_ActiveCronItemIDs(
     const std::string& NYM_ID,
     const std::string& NOTARY_ID)
@@ -1563,6 +1571,15 @@ std::string SwigWrap::GetAccountWallet_ID(const std::int32_t& nIndex)
     return OT::App().API().Exec().GetAccountWallet_ID(nIndex);
 }
 
+std::string SwigWrap::GetAccountWallet_List(
+    const std::string& NYM_ID,
+    const std::string& NOTARY_ID,
+    const std::string& INSTRUMENT_DEFINITION_ID)
+{
+    return comma(OT::App().API().Exec().GetAccountWallet_List(
+        NYM_ID, NOTARY_ID, INSTRUMENT_DEFINITION_ID));
+}
+
 std::string SwigWrap::GetAccountWallet_Name(const std::string& THE_ID)
 {
     return OT::App().API().Exec().GetAccountWallet_Name(THE_ID);
@@ -72,6 +72,7 @@ Context::Context(
     , local_nymbox_hash_()
     , remote_nymbox_hash_()
     , target_version_(targetVersion)
+    , open_editors_(0)
 {
 }
 
@@ -93,6 +94,7 @@ Context::Context(
     , local_nymbox_hash_(serialized.localnymboxhash())
     , remote_nymbox_hash_(serialized.remotenymboxhash())
     , target_version_(targetVersion)
+    , open_editors_(0)
 {
     for (const auto& it : serialized.acknowledgedrequestnumber()) {
         acknowledged_request_numbers_.insert(it);
@@ -138,6 +140,12 @@ bool Context::AddAcknowledgedNumber(const RequestNumber req)
     return add_acknowledged_number(lock, req);
 }
 
+void Context::begin_edit()
+{
+    Lock lock(lock_);
+    ++open_editors_;
+}
+
 std::size_t Context::AvailableNumbers() const
 {
     return available_transaction_numbers_.size();
@@ -200,6 +208,16 @@ void Context::finish_acknowledgements(
     }
 }
 
+// Returns true when the caller closed the last open editor and should sign and
+// save the context
+bool Context::end_edit(const Lock& lock)
+{
+    OT_ASSERT(verify_write_lock(lock));
+    OT_ASSERT(0 < open_editors_);
+
+    return 0 == --open_editors_;
+}
+
 Identifier Context::GetID(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
@@ -491,6 +509,8 @@ void Context::SetLocalNymboxHash(const Identifier& hash)
 {
     Lock lock(lock_);
 
+    if (hash == local_nymbox_hash_) return;
+
     local_nymbox_hash_ = hash;
 
     CalculateID(lock);
@@ -500,6 +520,8 @@ void Context::SetRemoteNymboxHash(const Identifier& hash)
 {
     Lock lock(lock_);
 
+    if (hash == remote_nymbox_hash_) return;
+
     remote_nymbox_hash_ = hash;
 
     CalculateID(lock);
@@ -41,8 +41,10 @@
 #include "opentxs/consensus/ServerContext.hpp"
 
 #include "opentxs/api/client/Wallet.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/Native.hpp"
 #include "opentxs/consensus/TransactionStatement.hpp"
+#include "opentxs/core/crypto/Libsodium.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/Item.hpp"
 #include "opentxs/core/Log.hpp"
@@ -60,6 +62,7 @@
 namespace opentxs
 {
 const std::string ServerContext::default_node_name_{DEFAULT_NODE_NAME};
+std::atomic<bool> ServerContext::sessions_{false};
 
 ServerContext::ManagedNumber::ManagedNumber(
     const TransactionNumber number,
@@ -121,6 +124,7 @@ ServerContext::ServerContext(
     , revision_(0)
     , highest_transaction_number_(0)
     , tentative_transaction_numbers_()
+    , session_public_(Data::Factory())
 {
 }
 
@@ -145,6 +149,7 @@ ServerContext::ServerContext(
     , highest_transaction_number_(
           serialized.servercontext().highesttransactionnumber())
     , tentative_transaction_numbers_()
+    , session_public_(Data::Factory())
 {
     for (const auto& it : serialized.servercontext().tentativerequestnumber()) {
         tentative_transaction_numbers_.insert(it);
@@ -236,11 +241,56 @@ const std::string& ServerContext::AdminPassword() const
 
 ServerConnection& ServerContext::Connection() { return connection_; }
 
+bool ServerContext::establish_session(const Lock& lock, const Message& reply)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(session_private_);
+
+    auto serverKey = Data::Factory();
+
+    if (false == reply.m_ascSessionKey.GetData(serverKey, false)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid session key."
+              << std::endl;
+
+        return false;
+    }
+
+    std::unique_ptr<OTPassword> requestKey(new OTPassword);
+    std::unique_ptr<OTPassword> replyKey(new OTPassword);
+    String id{};
+
+    OT_ASSERT(requestKey);
+    OT_ASSERT(replyKey);
+
+    if (false == Message::DeriveSessionKey(
+                     *session_private_,
+                     serverKey,
+                     session_public_,
+                     serverKey,
+                     *requestKey,
+                     *replyKey,
+                     id)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to derive session key." << std::endl;
+
+        return false;
+    }
+
+    session_request_key_.reset(requestKey.release());
+    session_reply_key_.reset(replyKey.release());
+    session_id_ = id;
+    session_private_.reset();
+    otInfo << OT_METHOD << __FUNCTION__ << ": Established session "
+           << session_id_ << std::endl;
+
+    return true;
+}
+
 bool ServerContext::finalize_server_command(Message& command) const
 {
     OT_ASSERT(nym_);
 
-    if (false == command.SignContract(*nym_)) {
+    if (false == sign_server_command(command)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to sign server message."
               << std::endl;
 
@@ -590,6 +640,11 @@ void ServerContext::SetRevision(const std::uint64_t revision)
     revision_.store(revision);
 }
 
+void ServerContext::SetSessions(const bool enabled)
+{
+    sessions_.store(enabled);
+}
+
 bool ServerContext::StaleNym() const
 {
     Lock lock(lock_);
@@ -705,6 +760,50 @@ bool ServerContext::ShouldRename(const std::string& defaultName) const
     return (contract->Alias() == name);
 }
 
+// Eligible requests are MACed once a session exists. Until then they are
+// signed, and offer the public half of an ephemeral key so the server can
+// answer the handshake in its (signed) reply.
+bool ServerContext::sign_server_command(Message& command) const
+{
+    const auto type = Message::Type(command.m_strCommand.Get());
+    const bool eligible = Message::SessionEligible(type);
+
+    if ((false == sessions_.load()) || (false == eligible)) {
+
+        return command.SignContract(*nym_);
+    }
+
+    Lock lock(session_lock_);
+
+    if (session_request_key_) {
+
+        return command.SignSession(session_id_, *session_request_key_);
+    }
+
+    if (false == bool(session_private_)) {
+        const auto& engine =
+            static_cast<const Libsodium&>(OT::App().Crypto().ED25519());
+        std::unique_ptr<OTPassword> privateKey(new OTPassword);
+        auto publicKey = Data::Factory();
+
+        OT_ASSERT(privateKey);
+
+        if (engine.RandomKeypair(*privateKey, publicKey)) {
+            session_private_.reset(privateKey.release());
+            session_public_ = publicKey;
+        } else {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to generate session key." << std::endl;
+        }
+    }
+
+    if (session_private_) {
+        command.m_ascSessionKey.SetData(session_public_, false);
+    }
+
+    return command.SignContract(*nym_);
+}
+
 proto::ConsensusType ServerContext::Type() const
 {
     return proto::CONSENSUSTYPE_SERVER;
@@ -863,6 +962,14 @@ RequestNumber ServerContext::UpdateRequestNumber(bool& sendStatus)
 
     OT_ASSERT(reply);
 
+    // Replies to this request used to be trusted on the strength of the
+    // transport alone. A session handshake needs a verified reply.
+    if (sessions_.load() && (false == VerifyReply(*reply))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid reply." << std::endl;
+
+        return {};
+    }
+
     const RequestNumber newNumber = reply->m_lNewRequestNum;
     Lock contextLock(lock_);
     add_acknowledged_number(contextLock, newNumber);
@@ -912,6 +1019,48 @@ bool ServerContext::Verify(const TransactionStatement& statement) const
     return true;
 }
 
+bool ServerContext::VerifyReply(const Message& reply)
+{
+    OT_ASSERT(remote_nym_);
+
+    Lock lock(session_lock_);
+
+    if (reply.m_strSessionID.Exists()) {
+        if (false == bool(session_reply_key_)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Reply belongs to an unknown session." << std::endl;
+
+            return false;
+        }
+
+        return reply.VerifySession(session_id_, *session_reply_key_);
+    }
+
+    if (false == reply.VerifySignature(*remote_nym_)) {
+
+        return false;
+    }
+
+    const auto type = Message::Type(reply.m_strCommand.Get());
+
+    if (session_request_key_ && Message::SessionEligible(type)) {
+        // The server no longer recognizes the session, for example because it
+        // restarted. Sign from now on until a new handshake completes.
+        otWarn << OT_METHOD << __FUNCTION__ << ": Session " << session_id_
+               << " was not accepted by the server." << std::endl;
+        session_request_key_.reset();
+        session_reply_key_.reset();
+        session_id_.Release();
+    }
+
+    if (reply.m_ascSessionKey.Exists() && session_private_ &&
+        (false == bool(session_request_key_))) {
+        establish_session(lock, reply);
+    }
+
+    return true;
+}
+
 bool ServerContext::VerifyTentativeNumber(const TransactionNumber& number) const
 {
     return (0 < tentative_transaction_numbers_.count(number));
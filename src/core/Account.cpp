@@ -67,6 +67,10 @@
 #include <memory>
 #include <string>
 
+// Inbox and outbox hashes saved without this version predate the
+// receipt-based box hash (see Ledger::calculate_box_hash), and are recomputed.
+#define BOX_HASH_VERSION "2"
+
 using namespace irr;
 using namespace io;
 
@@ -704,12 +708,14 @@ void Account::UpdateContents()
     if (!inboxHash_.IsEmpty()) {
         String strHash(inboxHash_);
         TagPtr tagBox(new Tag("inboxHash"));
+        tagBox->add_attribute("version", BOX_HASH_VERSION);
         tagBox->add_attribute("value", strHash.Get());
         tag.add_tag(tagBox);
     }
     if (!outboxHash_.IsEmpty()) {
         String strHash(outboxHash_);
         TagPtr tagBox(new Tag("outboxHash"));
+        tagBox->add_attribute("version", BOX_HASH_VERSION);
         tagBox->add_attribute("value", strHash.Get());
         tag.add_tag(tagBox);
     }
@@ -730,7 +736,7 @@ void Account::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 // return -1 if error, 0 if nothing, and 1 if the node was processed.
@@ -804,8 +810,9 @@ int32_t Account::ProcessXMLNode(IrrXMLReader*& xml)
         retval = 1;
     } else if (strNodeName.Compare("inboxHash")) {
 
+        const String strVersion = xml->getAttributeValue("version");
         String strHash = xml->getAttributeValue("value");
-        if (strHash.Exists()) {
+        if (strHash.Exists() && strVersion.Compare(BOX_HASH_VERSION)) {
             inboxHash_.SetString(strHash);
         }
         otLog3 << "Account inboxHash: " << strHash << "\n";
@@ -813,8 +820,9 @@ int32_t Account::ProcessXMLNode(IrrXMLReader*& xml)
         retval = 1;
     } else if (strNodeName.Compare("outboxHash")) {
 
+        const String strVersion = xml->getAttributeValue("version");
         String strHash = xml->getAttributeValue("value");
-        if (strHash.Exists()) {
+        if (strHash.Exists() && strVersion.Compare(BOX_HASH_VERSION)) {
             outboxHash_.SetString(strHash);
         }
         otLog3 << "Account outboxHash: " << strHash << "\n";
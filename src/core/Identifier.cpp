@@ -54,6 +54,9 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/OT.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace opentxs
 {
 
@@ -167,38 +170,32 @@ Identifier& Identifier::operator=(Identifier&& rhs)
 
 bool Identifier::operator==(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.Compare(ots2);
+    return 0 == compare(s2);
 }
 
 bool Identifier::operator!=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return !(ots1.Compare(ots2));
+    return 0 != compare(s2);
 }
 
 bool Identifier::operator>(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>(ots2);
+    return 0 < compare(s2);
 }
 
 bool Identifier::operator<(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<(ots2);
+    return 0 > compare(s2);
 }
 
 bool Identifier::operator<=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<=(ots2);
+    return 0 >= compare(s2);
 }
 
 bool Identifier::operator>=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>=(ots2);
+    return 0 <= compare(s2);
 }
 
 bool Identifier::CalculateDigest(const String& strInput, const ID type)
@@ -217,6 +214,28 @@ bool Identifier::CalculateDigest(const opentxs::Data& dataInput, const ID type)
         IDToHashType(type_), dataInput, *this);
 }
 
+// Compares the binary form directly instead of encoding both sides. Empty
+// identifiers are equal regardless of type, matching their (empty) string form.
+int Identifier::compare(const Identifier& rhs) const
+{
+    const auto lhsSize = GetSize();
+    const auto rhsSize = rhs.GetSize();
+
+    if ((0 == lhsSize) || (0 == rhsSize)) {
+
+        return (0 < lhsSize) - (0 < rhsSize);
+    }
+
+    if (type_ != rhs.type_) return (type_ < rhs.type_) ? -1 : 1;
+
+    const auto result =
+        std::memcmp(GetPointer(), rhs.GetPointer(), std::min(lhsSize, rhsSize));
+
+    if (0 != result) return result;
+
+    return (lhsSize > rhsSize) - (lhsSize < rhsSize);
+}
+
 // SET (binary id) FROM ENCODED STRING
 void Identifier::SetString(const String& encoded)
 {
@@ -51,6 +51,7 @@
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/Cheque.hpp"
 #include "opentxs/core/Contract.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Item.hpp"
 #include "opentxs/core/Log.hpp"
@@ -65,6 +66,7 @@
 
 #include <stdlib.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <cstdint>
 #include <irrxml/irrXML.hpp>
 #include <memory>
@@ -685,6 +687,106 @@ bool Ledger::CalculateHash(Identifier& theOutput)
     return bCalcDigest;
 }
 
+// Transaction numbers are never reused, so the digests of each receipt's
+// number and receipt hash, summed modulo 2^n, identify the contents of an
+// inbox or outbox. A sum (rather than XOR) keeps the same receipt counted
+// twice from cancelling itself out, and subtracting reverses a removal
+// exactly.
+void Ledger::accumulate_receipt(
+    std::vector<std::uint8_t>& accumulator,
+    const OTTransaction& receipt,
+    const bool add)
+{
+    const auto number = receipt.GetTransactionNum();
+    std::uint8_t bytes[sizeof(number)]{};
+    auto value = static_cast<std::uint64_t>(number);
+
+    // Big endian, so that clients and servers agree regardless of platform.
+    for (std::size_t i = sizeof(bytes); i > 0; --i) {
+        bytes[i - 1] = static_cast<std::uint8_t>(value & 0xff);
+        value >>= 8;
+    }
+
+    Identifier receiptHash;
+    receipt.CalculateReceiptHash(receiptHash);
+    auto preimage = Data::Factory(bytes, sizeof(bytes));
+    preimage->Concatenate(receiptHash.GetPointer(), receiptHash.GetSize());
+    Identifier digest;
+
+    if (!digest.CalculateDigest(preimage)) {
+        otErr << "OTLedger::accumulate_receipt: Failed to hash receipt "
+              << number << "\n";
+
+        OT_FAIL;
+    }
+
+    const auto* input = static_cast<const std::uint8_t*>(digest.GetPointer());
+    const auto size = digest.GetSize();
+
+    if (accumulator.size() < size) { accumulator.resize(size, 0); }
+
+    std::uint32_t carry{0};
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (add) {
+            const std::uint32_t sum = accumulator[i] + input[i] + carry;
+            accumulator[i] = static_cast<std::uint8_t>(sum & 0xff);
+            carry = sum >> 8;
+        } else {
+            const std::uint32_t subtrahend = input[i] + carry;
+            carry = (accumulator[i] < subtrahend) ? 1 : 0;
+            accumulator[i] =
+                static_cast<std::uint8_t>(accumulator[i] - subtrahend);
+        }
+    }
+}
+
+bool Ledger::calculate_box_hash(Identifier& theOutput) const
+{
+    theOutput.Release();
+    auto accumulator = receipt_accumulator_;
+
+    for (const auto& number : full_receipts_) {
+        const auto it = m_mapTransactions.find(number);
+
+        OT_ASSERT(m_mapTransactions.end() != it);
+        OT_ASSERT(nullptr != it->second);
+
+        accumulate_receipt(accumulator, *it->second, true);
+    }
+
+    auto preimage = Data::Factory();
+    const auto type = static_cast<std::uint8_t>(m_Type);
+    preimage->Concatenate(&type, sizeof(type));
+
+    for (const Identifier* id :
+         {&GetNymID(), &GetRealAccountID(), &GetRealNotaryID()}) {
+        preimage->Concatenate(id->GetPointer(), id->GetSize());
+    }
+
+    // A box that has been emptied hashes the same as one that never held
+    // anything.
+    const bool bEmpty = std::all_of(
+        accumulator.begin(), accumulator.end(), [](const std::uint8_t& byte) {
+            return 0 == byte;
+        });
+
+    if (!bEmpty) {
+        preimage->Concatenate(accumulator.data(), accumulator.size());
+    }
+
+    const bool bCalcDigest = theOutput.CalculateDigest(preimage);
+
+    if (!bCalcDigest) {
+        theOutput.Release();
+        otErr << "OTLedger::calculate_box_hash: Failed trying to calculate "
+                 "hash (for a "
+              << GetTypeString() << ")\n";
+    }
+
+    return bCalcDigest;
+}
+
 bool Ledger::CalculateInboxHash(Identifier& theOutput)
 {
     if (m_Type != Ledger::inbox) {
@@ -692,7 +794,7 @@ bool Ledger::CalculateInboxHash(Identifier& theOutput)
         return false;
     }
 
-    return CalculateHash(theOutput);
+    return calculate_box_hash(theOutput);
 }
 
 bool Ledger::CalculateOutboxHash(Identifier& theOutput)
@@ -702,7 +804,7 @@ bool Ledger::CalculateOutboxHash(Identifier& theOutput)
         return false;
     }
 
-    return CalculateHash(theOutput);
+    return calculate_box_hash(theOutput);
 }
 
 bool Ledger::CalculateNymboxHash(Identifier& theOutput)
@@ -778,10 +880,10 @@ bool Ledger::SaveInbox(Identifier* pInboxHash)  // If you pass the
     const bool bSaved = SaveGeneric(m_Type);
 
     // Sometimes the caller, when saving the Inbox, wants to know what the
-    // latest Inbox hash is. FYI, the InboxHash is calculated on the UNSIGNED
-    // contents of the Inbox. So if pInboxHash is not nullptr, then that is
-    // where
-    // I will put the new hash, as output for the caller of this function.
+    // latest Inbox hash is. FYI, the InboxHash covers the receipts in the
+    // Inbox (see accumulate_receipt) rather than its serialized form. So if
+    // pInboxHash is not nullptr, then that is where I will put the new hash,
+    // as output for the caller of this function.
     //
     if (bSaved && (nullptr != pInboxHash)) {
         pInboxHash->Release();
@@ -810,10 +912,10 @@ bool Ledger::SaveOutbox(Identifier* pOutboxHash)  // If you pass
     const bool bSaved = SaveGeneric(m_Type);
 
     // Sometimes the caller, when saving the Outbox, wants to know what the
-    // latest Outbox hash is. FYI, the OutboxHash is calculated on the UNSIGNED
-    // contents of the Outbox. So if pOutboxHash is not nullptr, then that is
-    // where
-    // I will put the new hash, as output for the caller of this function.
+    // latest Outbox hash is. FYI, the OutboxHash covers the receipts in the
+    // Outbox (see accumulate_receipt) rather than its serialized form. So if
+    // pOutboxHash is not nullptr, then that is where I will put the new hash,
+    // as output for the caller of this function.
     //
     if (bSaved && (nullptr != pOutboxHash)) {
         pOutboxHash->Release();
@@ -1105,6 +1207,7 @@ bool Ledger::RemoveTransaction(int64_t lTransactionNum, bool bDeleteIt)
         OTTransaction* pTransaction = it->second;
         OT_ASSERT(nullptr != pTransaction);
         m_mapTransactions.erase(it);
+        untrack_receipt(*pTransaction);
 
         if (bDeleteIt) {
             delete pTransaction;
@@ -1123,6 +1226,7 @@ bool Ledger::AddTransaction(OTTransaction& theTransaction)
     // If it's not already on the list, then add it...
     if (it == m_mapTransactions.end()) {
         m_mapTransactions[theTransaction.GetTransactionNum()] = &theTransaction;
+        track_receipt(theTransaction);
         theTransaction.SetParent(*this);  // for convenience
         return true;
     }
@@ -1839,7 +1943,7 @@ void Ledger::UpdateContents()  // Before transmission or serialization, this is
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 // LoadContract will call this function at the right time.
@@ -2146,6 +2250,7 @@ int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                         //
                         m_mapTransactions[pTransaction->GetTransactionNum()] =
                             pTransaction;
+                        track_receipt(*pTransaction);
                         pTransaction->SetParent(*this);
                         //                      otLog5 << "Loaded abbreviated
                         // transaction and adding to m_mapTransactions in
@@ -2314,6 +2419,7 @@ int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                 //
                 m_mapTransactions[pTransaction->GetTransactionNum()] =
                     pTransaction;
+                track_receipt(*pTransaction);
                 pTransaction->SetParent(*this);
                 //                otLog5 << "Loaded full transaction and adding
                 // to m_mapTransactions in OTLedger\n");
@@ -2417,6 +2523,9 @@ void Ledger::ReleaseTransactions()
         delete pTransaction;
         pTransaction = nullptr;
     }
+
+    receipt_accumulator_.clear();
+    full_receipts_.clear();
 }
 
 void Ledger::Release_Ledger() { ReleaseTransactions(); }
@@ -2429,4 +2538,20 @@ void Ledger::Release()
                           // now...
 }
 
+void Ledger::track_receipt(const OTTransaction& receipt)
+{
+    if (receipt.IsAbbreviated()) {
+        accumulate_receipt(receipt_accumulator_, receipt, true);
+    } else {
+        full_receipts_.insert(receipt.GetTransactionNum());
+    }
+}
+
+void Ledger::untrack_receipt(const OTTransaction& receipt)
+{
+    if (0 == full_receipts_.erase(receipt.GetTransactionNum())) {
+        accumulate_receipt(receipt_accumulator_, receipt, false);
+    }
+}
+
 }  // namespace opentxs
@@ -41,9 +41,15 @@
 #include "opentxs/core/Message.hpp"
 
 #include "opentxs/consensus/Context.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/Native.hpp"
 #include "opentxs/consensus/ServerContext.hpp"
+#include "opentxs/core/crypto/Libsodium.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/crypto/OTAsymmetricKey.hpp"
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/crypto/OTSignature.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/Tag.hpp"
@@ -57,8 +63,10 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/OT.hpp"
 
 #include <stdint.h>
+#include <cstdint>
 #include <stdexcept>
 #include <fstream>
 #include <irrxml/irrXML.hpp>
@@ -131,6 +139,10 @@
 #define ADD_CLAIM "addClaim"
 #define ADD_CLAIM_RESPONSE "addClaimResponse"
 
+#define SESSION_KEY_INFO "OT message session"
+#define SESSION_REQUEST_LABEL " client to server"
+#define SESSION_REPLY_LABEL " server to client"
+
 // PROTOCOL DOCUMENT
 
 // --- This is the file that implements the entire message protocol.
@@ -249,6 +261,33 @@ const std::map<MessageType, MessageType> Message::reply_message_{
     {MessageType::addClaim, MessageType::addClaimR},
 };
 
+const std::set<MessageType> Message::session_types_{
+    MessageType::getRequestNumber,
+    MessageType::getRequestNumberR,
+    MessageType::checkNym,
+    MessageType::checkNymR,
+    MessageType::getNymbox,
+    MessageType::getNymboxR,
+    MessageType::getBoxReceipt,
+    MessageType::getBoxReceiptR,
+    MessageType::getAccountData,
+    MessageType::getAccountDataR,
+    MessageType::queryInstrumentDefinitions,
+    MessageType::queryInstrumentDefinitionsR,
+    MessageType::getInstrumentDefinition,
+    MessageType::getInstrumentDefinitionR,
+    MessageType::getMint,
+    MessageType::getMintR,
+    MessageType::getMarketList,
+    MessageType::getMarketListR,
+    MessageType::getMarketOffers,
+    MessageType::getMarketOffersR,
+    MessageType::getMarketRecentTrades,
+    MessageType::getMarketRecentTradesR,
+    MessageType::getNymMarketOffers,
+    MessageType::getNymMarketOffersR,
+};
+
 const Message::ReverseTypeMap Message::message_types_ = make_reverse_map();
 
 Message::ReverseTypeMap Message::make_reverse_map()
@@ -302,6 +341,85 @@ std::string Message::ReplyCommand(const MessageType type)
     return Command(reply_command(type));
 }
 
+bool Message::SessionEligible(const MessageType type)
+{
+    return (1 == session_types_.count(type));
+}
+
+// HKDF-SHA256 over the X25519 shared secret, salted with both ephemeral keys.
+// Each direction gets its own key, labelled in the HKDF info, so that a MACed
+// request can never be passed off as a MACed reply or the other way around.
+bool Message::DeriveSessionKey(
+    const OTPassword& privateKey,
+    const Data& remoteKey,
+    const Data& clientKey,
+    const Data& serverKey,
+    OTPassword& requestKey,
+    OTPassword& replyKey,
+    String& id)
+{
+    const Ecdsa& engine =
+        static_cast<const Libsodium&>(OT::App().Crypto().ED25519());
+    OTPassword secret;
+
+    if (false == engine.SharedSecret(remoteKey, privateKey, secret)) {
+        otErr << __FUNCTION__ << ": Failed to calculate shared secret."
+              << std::endl;
+
+        return false;
+    }
+
+    auto transcript = Data::Factory(clientKey);
+    transcript += serverKey;
+    const OTPassword salt(transcript->GetPointer(), transcript->GetSize());
+    auto input = Data::Factory(secret.getMemory(), secret.getMemorySize());
+    OTPassword prk;
+    const auto& hash = OT::App().Crypto().Hash();
+    const bool extracted = hash.HMAC(proto::HASHTYPE_SHA256, salt, input, prk);
+    input->zeroMemory();
+
+    if (false == extracted) {
+        otErr << __FUNCTION__ << ": Failed to extract session key."
+              << std::endl;
+
+        return false;
+    }
+
+    const auto expand = [&](const std::string& label, OTPassword& key) -> bool {
+        const std::string info = std::string(SESSION_KEY_INFO) + label;
+        auto data = Data::Factory(info.data(), info.size());
+        const std::uint8_t counter{1};
+        data->Concatenate(&counter, sizeof(counter));
+
+        return hash.HMAC(proto::HASHTYPE_SHA256, prk, data, key);
+    };
+
+    if (false == expand(SESSION_REQUEST_LABEL, requestKey)) {
+        otErr << __FUNCTION__ << ": Failed to expand request key." << std::endl;
+
+        return false;
+    }
+
+    if (false == expand(SESSION_REPLY_LABEL, replyKey)) {
+        otErr << __FUNCTION__ << ": Failed to expand reply key." << std::endl;
+
+        return false;
+    }
+
+    Identifier sessionID;
+
+    if (false == sessionID.CalculateDigest(transcript)) {
+        otErr << __FUNCTION__ << ": Failed to calculate session id."
+              << std::endl;
+
+        return false;
+    }
+
+    id = String(sessionID);
+
+    return true;
+}
+
 bool Message::HarvestTransactionNumbers(
     ServerContext& context,
     Nym& nym,
@@ -439,6 +557,14 @@ void Message::UpdateContents()
     tag.add_attribute("version", m_strVersion.Get());
     tag.add_attribute("dateSigned", formatTimestamp(m_lTime));
 
+    if (m_ascSessionKey.Exists()) {
+        tag.add_attribute("sessionKey", m_ascSessionKey.Get());
+    }
+
+    if (m_strSessionID.Exists()) {
+        tag.add_attribute("session", m_strSessionID.Get());
+    }
+
     if (!updateContentsByType(tag)) {
         TagPtr pTag(new Tag(m_strCommand.Get()));
         pTag->add_attribute("requestNum", m_strRequestNum.Get());
@@ -479,7 +605,7 @@ void Message::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 bool Message::updateContentsByType(Tag& parent)
@@ -563,6 +689,9 @@ int32_t Message::processXmlNodeNotaryMessage(
 
     if (strDateSigned.Exists()) m_lTime = parseTimestamp(strDateSigned.Get());
 
+    m_ascSessionKey.Set(xml->getAttributeValue("sessionKey"));
+    m_strSessionID = xml->getAttributeValue("session");
+
     otInfo << "\n===> Loading XML for Message into memory structures...\n";
 
     return 1;
@@ -624,6 +753,87 @@ bool Message::SignContract(const Nym& theNym, const OTPasswordData* pPWData)
     return m_bIsSigned;
 }
 
+// Authenticates the message with the MAC of an established session instead of
+// a signature. The MAC takes the place of the signature in the serialized
+// message.
+bool Message::SignSession(const String& id, const OTPassword& key)
+{
+    ReleaseSignatures();
+    m_strSessionID = id;
+    UpdateContents();
+    const auto plaintext = trim(m_xmlUnsigned);
+    auto data = Data::Factory(plaintext.Get(), plaintext.GetLength());
+    OTPassword mac;
+
+    if (false == OT::App().Crypto().Hash().HMAC(
+                     proto::HASHTYPE_SHA256, key, data, mac)) {
+        otErr << __FUNCTION__ << ": Failed to calculate session MAC."
+              << std::endl;
+        m_bIsSigned = false;
+
+        return false;
+    }
+
+    std::unique_ptr<OTSignature> pSig(new OTSignature);
+    pSig->SetData(Data::Factory(mac.getMemory(), mac.getMemorySize()));
+    m_listSignatures.push_back(pSig.release());
+    m_bIsSigned = true;
+
+    return m_bIsSigned;
+}
+
+bool Message::VerifySession(const String& id, const OTPassword& key) const
+{
+    if ((false == m_strSessionID.Exists()) ||
+        (false == m_strSessionID.Compare(id))) {
+        otErr << __FUNCTION__ << ": Wrong session." << std::endl;
+
+        return false;
+    }
+
+    if (1 != m_listSignatures.size()) {
+        otErr << __FUNCTION__ << ": Missing session MAC." << std::endl;
+
+        return false;
+    }
+
+    auto provided = Data::Factory();
+
+    if (false == m_listSignatures.front()->GetData(provided)) {
+        otErr << __FUNCTION__ << ": Invalid session MAC." << std::endl;
+
+        return false;
+    }
+
+    const auto plaintext = trim(m_xmlUnsigned);
+    auto data = Data::Factory(plaintext.Get(), plaintext.GetLength());
+    OTPassword mac;
+
+    if (false == OT::App().Crypto().Hash().HMAC(
+                     proto::HASHTYPE_SHA256, key, data, mac)) {
+        otErr << __FUNCTION__ << ": Failed to calculate session MAC."
+              << std::endl;
+
+        return false;
+    }
+
+    if (provided->GetSize() != mac.getMemorySize()) {
+
+        return false;
+    }
+
+    // Compare in constant time.
+    const auto* lhs = static_cast<const std::uint8_t*>(provided->GetPointer());
+    const auto* rhs = mac.getMemory_uint8();
+    std::uint8_t difference{0};
+
+    for (std::size_t i = 0; i < provided->GetSize(); ++i) {
+        difference |= (lhs[i] ^ rhs[i]);
+    }
+
+    return (0 == difference);
+}
+
 // virtual (Contract)
 bool Message::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
     const
@@ -69,6 +69,7 @@
 #include "opentxs/core/Item.hpp"
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/NumList.hpp"
 #include "opentxs/core/NymIDSource.hpp"
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/OTStringXML.hpp"
@@ -297,9 +298,16 @@ bool Nym::AddContract(
 /// Though the parameter is a reference (forcing you to pass a real object),
 /// the Nym DOES take ownership of the object. Therefore it MUST be allocated
 /// on the heap, NOT the stack, or you will corrupt memory with this call.
-void Nym::AddOutpayments(Message& theMessage)
+bool Nym::AddOutpayments(Message& theMessage)
 {
-    m_dequeOutpayments.push_front(&theMessage);
+    Outpayment outpayment{};
+    outpayment.message_.reset(&theMessage);
+    // If the message can not be stored on its own it is still kept, and
+    // embedded in the nymfile the way older versions did.
+    const bool stored = store_outpayment(outpayment);
+    m_dequeOutpayments.push_front(std::move(outpayment));
+
+    return stored;
 }
 
 bool Nym::AddPaymentCode(
@@ -411,7 +419,7 @@ void Nym::ClearAll()
     m_mapInboxHash.clear();
     m_mapOutboxHash.clear();
     m_setAccounts.clear();
-    ClearOutpayments();
+    m_dequeOutpayments.clear();
 }
 
 void Nym::ClearCredentials()
@@ -435,7 +443,13 @@ void Nym::ClearCredentials()
 
 void Nym::ClearOutpayments()
 {
-    while (GetOutpaymentsCount() > 0) RemoveOutpaymentsByIndex(0);
+    for (const auto& outpayment : m_dequeOutpayments) {
+        if (false == outpayment.key_.empty()) {
+            m_setRemovedOutpayments.insert(outpayment.key_);
+        }
+    }
+
+    m_dequeOutpayments.clear();
 }
 
 bool Nym::CompareID(const Nym& RHS) const { return RHS.CompareID(m_nymID); }
@@ -526,6 +540,28 @@ void Nym::DisplayStatistics(String& strOutput)
     strOutput.Concatenate("Nym ID: %s\n", theStringID.Get());
 }
 
+// Called after the nymfile has been saved. The saved nymfile is the only
+// record of which stored messages are in use, so a key is erased once it no
+// longer refers to it. Identical messages share a key.
+void Nym::erase_outpayments()
+{
+    for (const auto& outpayment : m_dequeOutpayments) {
+        m_setRemovedOutpayments.erase(outpayment.key_);
+    }
+
+    for (const auto& key : m_setRemovedOutpayments) {
+        const bool erased = OTDB::EraseValueByKey(
+            OTFolders::Outpayments().Get(), String(m_nymID).Get(), key, "");
+
+        if (false == erased) {
+            otErr << __FUNCTION__ << ": Failed to erase stored outpayment "
+                  << key << std::endl;
+        }
+    }
+
+    m_setRemovedOutpayments.clear();
+}
+
 const Credential* Nym::GetChildCredential(
     const String& strMasterID,
     const String& strChildCredID) const
@@ -653,7 +689,7 @@ Message* Nym::GetOutpaymentsByIndex(std::int32_t nIndex) const
         return nullptr;
     }
 
-    return m_dequeOutpayments.at(nIndex);
+    return load_outpayment(m_dequeOutpayments.at(uIndex));
 }
 
 Message* Nym::GetOutpaymentsByTransNum(
@@ -668,8 +704,19 @@ Message* Nym::GetOutpaymentsByTransNum(
     const std::int32_t nCount = GetOutpaymentsCount();
 
     for (std::int32_t nIndex = 0; nIndex < nCount; ++nIndex) {
-        Message* pMsg = m_dequeOutpayments.at(nIndex);
-        OT_ASSERT(nullptr != pMsg);
+        const auto& outpayment = m_dequeOutpayments.at(nIndex);
+        const auto& numbers = outpayment.numbers_;
+
+        // Use the recorded transaction numbers to skip non-matching
+        // outpayments without loading and parsing them.
+        if ((false == numbers.empty()) && (0 == numbers.count(lTransNum))) {
+            continue;
+        }
+
+        Message* pMsg = load_outpayment(outpayment);
+
+        if (nullptr == pMsg) continue;
+
         String strPayment;
         std::unique_ptr<OTPayment> payment;
         std::unique_ptr<OTPayment>& pPayment(
@@ -748,7 +795,7 @@ void Nym::GetPrivateCredentials(String& strCredList, String::Map* pmapCredFiles)
     std::string str_result;
     tag.output(str_result);
 
-    strCredList.Concatenate("%s", str_result.c_str());
+    strCredList.Concatenate(str_result);
 }
 
 const OTAsymmetricKey& Nym::GetPrivateEncrKey() const
@@ -985,6 +1032,49 @@ void Nym::init_claims(const Lock& lock) const
     }
 }
 
+Message* Nym::load_outpayment(const Outpayment& outpayment) const
+{
+    if (outpayment.message_) return outpayment.message_.get();
+
+    const std::string serialized = OTDB::QueryPlainString(
+        OTFolders::Outpayments().Get(),
+        String(m_nymID).Get(),
+        outpayment.key_,
+        "");
+
+    if (serialized.empty()) {
+        otErr << __FUNCTION__ << ": Missing stored outpayment "
+              << outpayment.key_ << std::endl;
+
+        return nullptr;
+    }
+
+    Identifier digest;
+    digest.CalculateDigest(String(serialized));
+
+    if (outpayment.key_ != String(digest).Get()) {
+        otErr << __FUNCTION__ << ": Stored outpayment " << outpayment.key_
+              << " does not match its key" << std::endl;
+
+        return nullptr;
+    }
+
+    std::unique_ptr<Message> message(new Message);
+
+    OT_ASSERT(message);
+
+    if (false == message->LoadContractFromString(String(serialized))) {
+        otErr << __FUNCTION__ << ": Invalid stored outpayment "
+              << outpayment.key_ << std::endl;
+
+        return nullptr;
+    }
+
+    outpayment.message_.reset(message.release());
+
+    return outpayment.message_.get();
+}
+
 bool Nym::LoadCredentialIndex(const serializedCredentialIndex& index)
 {
     if (!proto::Validate<proto::CredentialIndex>(index, VERBOSE)) {
@@ -994,6 +1084,8 @@ bool Nym::LoadCredentialIndex(const serializedCredentialIndex& index)
         return false;
     }
 
+    // Loading again must replace the existing sets, not leak them.
+    ClearCredentials();
     version_ = index.version();
     index_ = index.index();
     revision_.store(index.revision());
@@ -1825,21 +1917,43 @@ bool Nym::LoadNymFromString(
                                     true);  // linebreaks == true.
 
                                 if (strMessage.GetLength() > 2) {
-                                    Message* pMessage = new Message;
-                                    OT_ASSERT(nullptr != pMessage);
-
-                                    if (pMessage->LoadContractFromString(
-                                            strMessage))
+                                    Outpayment outpayment{};
+                                    outpayment.message_.reset(new Message);
+
+                                    OT_ASSERT(outpayment.message_);
+
+                                    // Older nymfiles embed the whole
+                                    // message. Move it out to its own
+                                    // storage; the next save of the
+                                    // nymfile will only reference it. If
+                                    // that fails it stays embedded.
+                                    if (outpayment.message_
+                                            ->LoadContractFromString(
+                                                strMessage)) {
+                                        store_outpayment(outpayment);
                                         m_dequeOutpayments.push_back(
-                                            pMessage);  // takes ownership
-                                    else
-                                        delete pMessage;
+                                            std::move(outpayment));
+                                    }
                                 }
                             }
                         }  // strNodeData
                     }      // EXN_TEXT
                 }          // outpayments message
-                else {
+                else if (strNodeName.Compare("outpayment")) {
+                    Outpayment outpayment{};
+                    const String strKey = xml->getAttributeValue("key");
+                    outpayment.key_ = strKey.Get();
+                    const String strNumbers =
+                        xml->getAttributeValue("transNums");
+
+                    if (strNumbers.Exists()) {
+                        NumList(strNumbers).Output(outpayment.numbers_);
+                    }
+
+                    if (false == outpayment.key_.empty()) {
+                        m_dequeOutpayments.push_back(std::move(outpayment));
+                    }
+                } else {
                     // unknown element type
                     otErr << "Unknown element type in " << __FUNCTION__ << ": "
                           << xml->getNodeName() << "\n";
@@ -2052,6 +2166,25 @@ std::string Nym::Name() const
     return alias_;
 }
 
+std::set<std::int64_t> Nym::outpayment_numbers(const Message& message)
+{
+    std::set<std::int64_t> output{};
+    String strPayment;
+
+    if (message.m_ascPayload.Exists() &&
+        message.m_ascPayload.GetString(strPayment) && strPayment.Exists()) {
+        OTPayment payment(strPayment);
+        NumList numbers;
+
+        if (payment.IsValid() && payment.SetTempValues() &&
+            payment.GetAllTransactionNumbers(numbers)) {
+            numbers.Output(output);
+        }
+    }
+
+    return output;
+}
+
 bool Nym::Path(proto::HDPath& output) const
 {
     Lock lock(lock_);
@@ -2192,10 +2325,15 @@ bool Nym::RemoveOutpaymentsByIndex(const std::int32_t nIndex, bool bDeleteIt)
         return false;
     }
 
-    Message* pMessage = m_dequeOutpayments.at(nIndex);
-    OT_ASSERT(nullptr != pMessage);
+    auto it = m_dequeOutpayments.begin() + uIndex;
+    // The caller may have obtained the message from GetOutpaymentsByIndex
+    // and keep it, so load it before it leaves the box.
+    Message* pMessage = load_outpayment(*it);
+    it->message_.release();
+
+    if (false == it->key_.empty()) m_setRemovedOutpayments.insert(it->key_);
 
-    m_dequeOutpayments.erase(m_dequeOutpayments.begin() + uIndex);
+    m_dequeOutpayments.erase(it);
 
     if (bDeleteIt) delete pMessage;
 
@@ -2214,9 +2352,7 @@ bool Nym::RemoveOutpaymentsByTransNum(
 
     if ((nullptr != pMsg) && (nReturnIndex > (-1)) &&
         (uIndex < m_dequeOutpayments.size())) {
-        m_dequeOutpayments.erase(m_dequeOutpayments.begin() + uIndex);
-        if (bDeleteIt) delete pMsg;
-        return true;
+        return RemoveOutpaymentsByIndex(nReturnIndex, bDeleteIt);
     }
     return false;
 }
@@ -2458,22 +2594,28 @@ bool Nym::SavePseudonym(String& strNym)
             "FOR DELETION AT ITS OWN REQUEST");
     }
 
-    if (!(m_dequeOutpayments.empty())) {
-        for (std::uint32_t i = 0; i < m_dequeOutpayments.size(); i++) {
-            Message* pMessage = m_dequeOutpayments.at(i);
-            OT_ASSERT(nullptr != pMessage);
+    // The outpayment messages themselves are stored separately, so that
+    // sending a payment does not grow (and re-sign) the whole nymfile.
+    for (const auto& outpayment : m_dequeOutpayments) {
+        if (outpayment.key_.empty()) {
+            OT_ASSERT(outpayment.message_);
 
-            String strOutpayments(*pMessage);
+            const OTASCIIArmor ascOutpayment(String(*outpayment.message_));
+            tag.add_tag("outpaymentsMessage", ascOutpayment.Get());
 
-            OTASCIIArmor ascOutpayments;
+            continue;
+        }
 
-            if (strOutpayments.Exists())
-                ascOutpayments.SetString(strOutpayments);
+        TagPtr pTag(new Tag("outpayment"));
+        pTag->add_attribute("key", outpayment.key_);
 
-            if (ascOutpayments.Exists()) {
-                tag.add_tag("outpaymentsMessage", ascOutpayments.Get());
-            }
+        if (false == outpayment.numbers_.empty()) {
+            String strNumbers;
+            NumList(outpayment.numbers_).Output(strNumbers);
+            pTag->add_attribute("transNums", strNumbers.Get());
         }
+
+        tag.add_tag(pTag);
     }
 
     // These are used on the server side.
@@ -2519,7 +2661,7 @@ bool Nym::SavePseudonym(String& strNym)
     std::string str_result;
     tag.output(str_result);
 
-    strNym.Concatenate("%s", str_result.c_str());
+    strNym.Concatenate(str_result);
 
     return true;
 }
@@ -2537,6 +2679,8 @@ bool Nym::SavePseudonym(const char* szFoldername, const char* szFilename)
     if (!bSaved)
         otErr << __FUNCTION__ << ": Error saving file: " << szFoldername
               << Log::PathSeparator() << szFilename << "\n";
+    else
+        erase_outpayments();
 
     return bSaved;
 }
@@ -2593,6 +2737,8 @@ bool Nym::SaveSignedNymfile(const Nym& SIGNER_NYM)
             otErr << __FUNCTION__
                   << ": Failed while calling theNymfile.SaveFile() for Nym "
                   << strNymID << " using Signer Nym " << strSignerNymID << "\n";
+        } else {
+            erase_outpayments();
         }
 
         return bSaved;
@@ -2841,6 +2987,33 @@ bool Nym::SetVerificationSet(const proto::VerificationSet& data)
     return false;
 }
 
+// Stores the outpayment's message under a key derived from its contents, and
+// records the transaction numbers it contains for GetOutpaymentsByTransNum.
+bool Nym::store_outpayment(Outpayment& outpayment) const
+{
+    OT_ASSERT(outpayment.message_);
+
+    const String serialized(*outpayment.message_);
+    Identifier key;
+    key.CalculateDigest(serialized);
+    outpayment.key_ = String(key).Get();
+    outpayment.numbers_ = outpayment_numbers(*outpayment.message_);
+    const bool stored = OTDB::StorePlainString(
+        serialized.Get(),
+        OTFolders::Outpayments().Get(),
+        String(m_nymID).Get(),
+        outpayment.key_,
+        "");
+
+    if (false == stored) {
+        otErr << __FUNCTION__ << ": Failed to store outpayment "
+              << outpayment.key_ << std::endl;
+        outpayment.key_.clear();
+    }
+
+    return stored;
+}
+
 std::unique_ptr<OTPassword> Nym::TransportKey(Data& pubkey) const
 {
     bool found{false};
@@ -1403,21 +1403,15 @@ bool BufferPB::UnpackString(std::string& theString)
 
 bool BufferPB::ReadFromIStream(std::istream& inStream, int64_t lFilesize)
 {
-    unsigned long size = static_cast<unsigned long>(lFilesize);
+    const auto size = static_cast<std::size_t>(lFilesize);
 
-    char* buf = new char[size];
-    OT_ASSERT(nullptr != buf);
+    // Read straight into the buffer instead of through a temporary array.
+    m_buffer.resize(size);
+    inStream.read(&m_buffer[0], size);
 
-    inStream.read(buf, size);
+    if (inStream.good()) return true;
 
-    if (inStream.good()) {
-        m_buffer.assign(buf, size);
-        delete[] buf;
-        return true;
-    }
-
-    delete[] buf;
-    buf = nullptr;
+    m_buffer.clear();
 
     return false;
 
@@ -1465,12 +1459,19 @@ void BufferPB::SetData(const uint8_t* pData, size_t theSize)
  */
 //
 
+// Each element's hookBeforePack() rewrites every field of its internal
+// message, so the packed element is swapped into the list rather than copied.
+// Likewise on unpack, the parent's element is swapped into the new wrapper,
+// since the parent message is rebuilt from the list on the next pack anyway.
+//
 #define OT_IMPLEMENT_PB_LIST_PACK(pb_name, element_type)                       \
     __pb_obj.clear_##pb_name();                                                \
+    __pb_obj.mutable_##pb_name()->Reserve(                                     \
+        static_cast<int>(list_##element_type##s.size()));                      \
     for (auto it = list_##element_type##s.begin();                             \
          it != list_##element_type##s.end();                                   \
          ++it) {                                                               \
-        PointerTo##element_type thePtr = (*it);                                \
+        const PointerTo##element_type& thePtr = (*it);                         \
         element_type##PB* pObject =                                            \
             dynamic_cast<element_type##PB*>(thePtr.pointer());                 \
         OT_ASSERT(nullptr != pObject);                                         \
@@ -1482,13 +1483,14 @@ void BufferPB::SetData(const uint8_t* pData, size_t theSize)
         element_type##_InternalPB* pNewInternal = __pb_obj.add_##pb_name();    \
         OT_ASSERT(nullptr != pNewInternal);                                    \
         pObject->hookBeforePack();                                             \
-        pNewInternal->CopyFrom(*pInternal);                                    \
+        pNewInternal->Swap(pInternal);                                         \
     }
 
 #define OT_IMPLEMENT_PB_LIST_UNPACK(pb_name, element_type, ELEMENT_ENUM)       \
-    while (Get##element_type##Count() > 0) Remove##element_type(0);            \
+    list_##element_type##s.clear();                                            \
     for (int32_t i = 0; i < __pb_obj.pb_name##_size(); i++) {                  \
-        const element_type##_InternalPB& theInternal = __pb_obj.pb_name(i);    \
+        element_type##_InternalPB* pTheInternal =                              \
+            __pb_obj.mutable_##pb_name(i);                                     \
         element_type##PB* pNewWrapper = dynamic_cast<element_type##PB*>(       \
             Storable::Create(ELEMENT_ENUM, PACK_PROTOCOL_BUFFERS));            \
         OT_ASSERT(nullptr != pNewWrapper);                                     \
@@ -1498,7 +1500,7 @@ void BufferPB::SetData(const uint8_t* pData, size_t theSize)
         element_type##_InternalPB* pInternal =                                 \
             dynamic_cast<element_type##_InternalPB*>(pMessage);                \
         OT_ASSERT(nullptr != pInternal);                                       \
-        pInternal->CopyFrom(theInternal);                                      \
+        pInternal->Swap(pTheInternal);                                         \
         pNewWrapper->hookAfterUnpack();                                        \
         PointerTo##element_type thePtr(                                        \
             dynamic_cast<element_type*>(pNewWrapper));                         \
@@ -1530,6 +1532,7 @@ template <>
 void StringMapPB::hookBeforePack()
 {
     __pb_obj.clear_node();  // "node" is the repeated field of Key/Values.
+    __pb_obj.mutable_node()->Reserve(static_cast<int>(the_map.size()));
 
     // Loop through all the key/value pairs in the map, and add them to
     // __pb_obj.node.
@@ -1548,11 +1551,12 @@ void StringMapPB::hookAfterUnpack()
 
     the_map.clear();
 
+    // The nodes were packed from a sorted map, so each one normally belongs
+    // at the end.
     for (int32_t i = 0; i < __pb_obj.node_size(); i++) {
         const KeyValue_InternalPB& theNode = __pb_obj.node(i);
 
-        the_map.insert(std::pair<std::string, std::string>(
-            theNode.key(), theNode.value()));
+        the_map.emplace_hint(the_map.end(), theNode.key(), theNode.value());
     }
 }
 
@@ -2649,13 +2653,23 @@ ot_exit_block:
     const std::string strPath(strBufPath);
     strOutput = strPath;
 
+    // Once a folder has been built, the cache answers for the whole path and
+    // the single check below is the only one made on each write.
     if (bMakePath) {
         bool bFolderCreated = false;
-        OTPaths::BuildFolderPath(strFolder.c_str(), bFolderCreated);
+        OTPaths::BuildFolderPath(strFolder.c_str(), bFolderCreated, true);
     }
 
     {
-        const bool bFolderExists = OTPaths::PathExists(strFolder.c_str());
+        bool bFolderExists = OTPaths::PathExists(strFolder.c_str());
+
+        if (bMakePath && !bFolderExists) {
+            // The cache skipped a folder which has since been removed from
+            // disk. Check every folder on the path and build it once more.
+            bool bFolderCreated = false;
+            OTPaths::BuildFolderPath(strFolder.c_str(), bFolderCreated, false);
+            bFolderExists = OTPaths::PathExists(strFolder.c_str());
+        }
 
         if (bMakePath && !bFolderExists) {
             otErr << __FUNCTION__ << ": Error: was told to make path, however "
@@ -4231,7 +4231,7 @@ void OTTransaction::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 /*
@@ -5519,6 +5519,15 @@ int64_t OTTransaction::GetNumberOfOrigin()
     return m_lNumberOfOrigin;
 }
 
+void OTTransaction::CalculateReceiptHash(Identifier& theOutput) const
+{
+    if (IsAbbreviated()) {
+        theOutput = m_Hash;
+    } else {
+        CalculateContractID(theOutput);
+    }
+}
+
 void OTTransaction::CalculateNumberOfOrigin()
 {
     OT_ASSERT(!IsAbbreviated());
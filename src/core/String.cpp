@@ -1231,14 +1231,38 @@ void String::Concatenate(const char* fmt, ...)
 void String::Concatenate(const String& strBuf)
 {
     std::string str_output;
+    str_output.reserve(length_ + strBuf.GetLength());
 
-    if ((length_ > 0) && (nullptr != data_)) str_output += data_;
+    if ((length_ > 0) && (nullptr != data_)) str_output.append(data_, length_);
 
     if (strBuf.Exists() && (strBuf.GetLength() > 0)) str_output += strBuf.Get();
 
     Set(str_output.c_str());
 }
 
+// append a std::string at the end of the current buffer. Unlike the printf
+// style overload, this copies the input once instead of formatting it into a
+// temporary first.
+void String::Concatenate(const std::string& data)
+{
+    if (data.empty()) return;
+
+    if ((0 == length_) || (nullptr == data_)) {
+        Release();
+        LowLevelSet(data.c_str(), static_cast<uint32_t>(data.size()));
+
+        return;
+    }
+
+    std::string str_output;
+    str_output.reserve(length_ + data.size());
+    str_output.append(data_, length_);
+    str_output.append(data);
+
+    Release();
+    LowLevelSet(str_output.c_str(), static_cast<uint32_t>(str_output.size()));
+}
+
 void String::WriteToFile(std::ostream& ofs) const
 {
     if (!data_) {
@@ -329,30 +329,13 @@ KeyCredential::KeyCredential(
         const auto curve = CryptoAsymmetric::KeyTypeToCurve(keyType);
 
         if ((EcdsaCurve::ERROR != curve) && nymParameters.Entropy()) {
-            m_AuthentKey = DeriveHDKeypair(
+            DeriveHDKeypairs(
                 *nymParameters.Entropy(),
                 nymParameters.Seed(),
                 nymParameters.Nym(),
                 nymParameters.Credset(),
                 nymParameters.CredIndex(),
-                curve,
-                proto::KEYROLE_AUTH);
-            m_EncryptKey = DeriveHDKeypair(
-                *nymParameters.Entropy(),
-                nymParameters.Seed(),
-                nymParameters.Nym(),
-                nymParameters.Credset(),
-                nymParameters.CredIndex(),
-                curve,
-                proto::KEYROLE_ENCRYPT);
-            m_SigningKey = DeriveHDKeypair(
-                *nymParameters.Entropy(),
-                nymParameters.Seed(),
-                nymParameters.Nym(),
-                nymParameters.Credset(),
-                nymParameters.CredIndex(),
-                curve,
-                proto::KEYROLE_SIGN);
+                curve);
         }
 #endif
     }
@@ -376,14 +359,13 @@ bool KeyCredential::New(const NymParameters& nymParameters)
 }
 
 #if OT_CRYPTO_SUPPORTED_KEY_HD
-std::shared_ptr<OTKeypair> KeyCredential::DeriveHDKeypair(
+void KeyCredential::DeriveHDKeypairs(
     const OTPassword& seed,
     const std::string& fingerprint,
     const uint32_t nym,
     const uint32_t credset,
     const uint32_t credindex,
-    const EcdsaCurve& curve,
-    const proto::KeyRole role)
+    const EcdsaCurve& curve)
 {
     proto::HDPath keyPath;
     keyPath.set_version(1);
@@ -399,28 +381,31 @@ std::shared_ptr<OTKeypair> KeyCredential::DeriveHDKeypair(
     keyPath.add_child(
         credindex | static_cast<std::uint32_t>(Bip32Child::HARDENED));
 
-    switch (role) {
-        case proto::KEYROLE_AUTH:
-            keyPath.add_child(
-                static_cast<std::uint32_t>(Bip32Child::AUTH_KEY) |
-                static_cast<std::uint32_t>(Bip32Child::HARDENED));
-            break;
-        case proto::KEYROLE_ENCRYPT:
-            keyPath.add_child(
-                static_cast<std::uint32_t>(Bip32Child::ENCRYPT_KEY) |
-                static_cast<std::uint32_t>(Bip32Child::HARDENED));
-            break;
-        case proto::KEYROLE_SIGN:
-            keyPath.add_child(
-                static_cast<std::uint32_t>(Bip32Child::SIGN_KEY) |
-                static_cast<std::uint32_t>(Bip32Child::HARDENED));
-            break;
-        default:
-            break;
-    }
+    // The three role keys are siblings, so walk the shared path once
+    const auto keys = OT::App().Crypto().BIP32().GetHDKeys(
+        curve,
+        seed,
+        keyPath,
+        {static_cast<std::uint32_t>(Bip32Child::AUTH_KEY) |
+             static_cast<std::uint32_t>(Bip32Child::HARDENED),
+         static_cast<std::uint32_t>(Bip32Child::ENCRYPT_KEY) |
+             static_cast<std::uint32_t>(Bip32Child::HARDENED),
+         static_cast<std::uint32_t>(Bip32Child::SIGN_KEY) |
+             static_cast<std::uint32_t>(Bip32Child::HARDENED)});
+
+    if (3 != keys.size()) return;
+
+    m_AuthentKey = HDKeypair(curve, proto::KEYROLE_AUTH, keys.at(0));
+    m_EncryptKey = HDKeypair(curve, proto::KEYROLE_ENCRYPT, keys.at(1));
+    m_SigningKey = HDKeypair(curve, proto::KEYROLE_SIGN, keys.at(2));
+}
 
+std::shared_ptr<OTKeypair> KeyCredential::HDKeypair(
+    const EcdsaCurve& curve,
+    const proto::KeyRole role,
+    serializedAsymmetricKey privateKey)
+{
     std::shared_ptr<OTKeypair> newKeypair;
-    auto privateKey = OT::App().Crypto().BIP32().GetHDKey(curve, seed, keyPath);
 
     if (!privateKey) {
         return newKeypair;
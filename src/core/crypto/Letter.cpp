@@ -41,6 +41,7 @@
 #include "opentxs/core/crypto/Letter.hpp"
 
 #include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/crypto/Symmetric.hpp"
 #include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/Native.hpp"
@@ -77,11 +78,105 @@
 
 #include <irrxml/irrXML.hpp>
 #include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
+
+#define LETTER_KEY_TAG "opentxs letter session key"
 
 namespace opentxs
 {
+bool Letter::AddECRecipients(
+    const Ecdsa& engine,
+    const AsymmetricKeyEC& dhPrivateKey,
+    const mapOfECKeys& recipients,
+    const proto::SymmetricKey& sessionKey,
+    const proto::SymmetricMode mode,
+    proto::Envelope& envelope)
+{
+    std::vector<const AsymmetricKeyEC*> keys{};
+
+    for (const auto& it : recipients) {
+        keys.push_back(it.second);
+    }
+
+    std::vector<proto::SymmetricKey> sealed(keys.size());
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+
+    // Each recipient gets its own copy of the session key, so the workers
+    // share nothing but the read-only inputs and their own output slot
+    auto seal = [&](const std::size_t index) -> bool {
+        OTPasswordData dhPassword("");
+        OTPassword secret;
+
+        if (false == engine.SharedSecret(
+                         dhPrivateKey, *keys.at(index), dhPassword, secret)) {
+            return false;
+        }
+
+        std::string tag{};
+
+        if (false == KeyTag(secret, tag)) return false;
+
+        auto key = OT::App().Crypto().Symmetric().Key(sessionKey, mode);
+
+        if (false == bool(key)) return false;
+
+        OTPasswordData defaultPassword("");
+        DefaultPassword(defaultPassword);
+
+        if (false == key->ChangePassword(defaultPassword, secret, tag)) {
+            return false;
+        }
+
+        return key->Serialize(sealed.at(index));
+    };
+    auto worker = [&]() -> void {
+        for (auto i = next++; i < keys.size(); i = next++) {
+            if (failed.load()) return;
+
+            if (false == seal(i)) failed.store(true);
+        }
+    };
+
+    std::size_t threads{1};
+
+    if (PARALLEL_RECIPIENTS < keys.size()) {
+        threads = std::min<std::size_t>(
+            std::max(1u, std::thread::hardware_concurrency()), keys.size());
+    }
+
+    std::vector<std::future<void>> workers{};
+
+    for (std::size_t i = 1; i < threads; ++i) {
+        workers.emplace_back(std::async(std::launch::async, worker));
+    }
+
+    worker();
+
+    for (auto& it : workers) {
+        it.get();
+    }
+
+    if (failed.load()) {
+        otErr << __FUNCTION__ << ": Session key encryption failed."
+              << std::endl;
+
+        return false;
+    }
+
+    for (auto& it : sealed) {
+        *envelope.add_sessionkey() = it;
+    }
+
+    return true;
+}
+
 bool Letter::AddRSARecipients(
     __attribute__((unused)) const mapOfAsymmetricKeys& recipients,
     __attribute__((unused)) const SymmetricKey& sessionKey,
@@ -135,6 +230,25 @@ bool Letter::DefaultPassword(OTPasswordData& password)
     return password.SetOverride(defaultPassword);
 }
 
+bool Letter::KeyTag(const OTPassword& secret, std::string& tag)
+{
+    const std::string domain{LETTER_KEY_TAG};
+    auto data = Data::Factory(domain.data(), domain.size());
+    OTPassword digest;
+
+    if (false == OT::App().Crypto().Hash().HMAC(
+                     proto::HASHTYPE_SHA256, secret, data, digest)) {
+        otErr << __FUNCTION__ << ": Failed to derive key tag." << std::endl;
+
+        return false;
+    }
+
+    tag.assign(
+        static_cast<const char*>(digest.getMemory()), digest.getMemorySize());
+
+    return true;
+}
+
 bool Letter::SortRecipients(
     const mapOfAsymmetricKeys& recipients,
     mapOfAsymmetricKeys& RSARecipients,
@@ -213,6 +327,18 @@ bool Letter::Seal(
         }
     }
 
+    // Recipients unlock their own copies of this key, which leaves the
+    // original usable with the default password for every recipient
+    proto::SymmetricKey serializedKey;
+
+    if ((haveRecipientsECDSA || haveRecipientsED25519) &&
+        (false == sessionKey->Serialize(serializedKey))) {
+        otErr << __FUNCTION__ << ": Session key serialization failed."
+              << std::endl;
+
+        return false;
+    }
+
     if (haveRecipientsECDSA) {
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
 #if OT_CRYPTO_USING_LIBSECP256K1
@@ -235,27 +361,14 @@ bool Letter::Seal(
 
         OT_ASSERT(dhPrivateKey);
 
-        // Individually encrypt the session key to each recipient and add
-        // the encrypted key to the global list of session keys for this
-        // letter.
-        for (auto it : secp256k1Recipients) {
-            OTPassword newKeyPassword;
-            const bool haveSessionKey = engine.EncryptSessionKeyECDH(
-                *dhPrivateKey,
-                *it.second,
-                defaultPassword,
-                *sessionKey,
-                newKeyPassword);
-
-            if (haveSessionKey) {
-                auto& serializedSessionKey = *output.add_sessionkey();
-                sessionKey->Serialize(serializedSessionKey);
-            } else {
-                otErr << __FUNCTION__ << ": Session key encryption failed."
-                      << std::endl;
-
-                return false;
-            }
+        if (false == AddECRecipients(
+                         engine,
+                         *dhPrivateKey,
+                         secp256k1Recipients,
+                         serializedKey,
+                         output.ciphertext().mode(),
+                         output)) {
+            return false;
         }
 #else
         otErr << __FUNCTION__ << ": Attempting to Seal to "
@@ -285,27 +398,14 @@ bool Letter::Seal(
 
         OT_ASSERT(dhPrivateKey);
 
-        // Individually encrypt the session key to each recipient and add
-        // the encrypted key to the global list of session keys for this
-        // letter.
-        for (auto it : ed25519Recipients) {
-            OTPassword newKeyPassword;
-            const bool haveSessionKey = engine.EncryptSessionKeyECDH(
-                *dhPrivateKey,
-                *it.second,
-                defaultPassword,
-                *sessionKey,
-                newKeyPassword);
-
-            if (haveSessionKey) {
-                auto& serializedSessionKey = *output.add_sessionkey();
-                sessionKey->Serialize(serializedSessionKey);
-            } else {
-                otErr << __FUNCTION__ << ": Session key encryption failed."
-                      << std::endl;
-
-                return false;
-            }
+        if (false == AddECRecipients(
+                         engine,
+                         *dhPrivateKey,
+                         ed25519Recipients,
+                         serializedKey,
+                         output.ciphertext().mode(),
+                         output)) {
+            return false;
         }
     }
 
@@ -390,13 +490,45 @@ bool Letter::Open(
                 OTAsymmetricKey::KeyFactory(ephemeralPubkey)));
         }
 
-        // The only way to know which session key (might) belong to us to try
-        // them all
-        for (auto& it : serialized.sessionkey()) {
+        if (false == bool(dhPublicKey)) {
+            otErr << __FUNCTION__ << ": Invalid ephemeral public key."
+                  << std::endl;
+
+            return false;
+        }
+
+        OTPassword secret;
+
+        if (false == ecKey->ECDSA().SharedSecret(
+                         *ecKey, *dhPublicKey, keyPassword, secret)) {
+            return false;
+        }
+
+        std::string tag{};
+        KeyTag(secret, tag);
+        OTPasswordData unlockPassword("");
+        unlockPassword.SetOverride(secret);
+
+        // Try the session key tagged for us first. Letters sealed before key
+        // tags existed carry random ivs, so the rest are still tried after.
+        std::vector<const proto::SymmetricKey*> candidates{};
+
+        for (const auto& it : serialized.sessionkey()) {
+            const auto& iv = it.key().iv();
+            const bool tagged =
+                (false == iv.empty()) && (0 == tag.compare(0, iv.size(), iv));
+
+            if (tagged) {
+                candidates.insert(candidates.begin(), &it);
+            } else {
+                candidates.push_back(&it);
+            }
+        }
+
+        for (const auto* it : candidates) {
             key = OT::App().Crypto().Symmetric().Key(
-                it, serialized.ciphertext().mode());
-            haveSessionKey = ecKey->ECDSA().DecryptSessionKeyECDH(
-                *ecKey, *dhPublicKey, keyPassword, *key);
+                *it, serialized.ciphertext().mode());
+            haveSessionKey = key && key->Unlock(unlockPassword);
 
             if (haveSessionKey) {
                 break;
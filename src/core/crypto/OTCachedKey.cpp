@@ -73,6 +73,8 @@ namespace opentxs
 OTCachedKey::OTCachedKey(const std::int32_t nTimeoutSeconds)
     : general_lock_()
     , master_password_lock_()
+    , timer_lock_()
+    , timer_()
     , shutdown_(false)
     , use_system_keyring_(false)
     , paused_(false)
@@ -766,15 +768,27 @@ bool OTCachedKey::Pause()
 void OTCachedKey::release_thread() const
 {
     shutdown_.store(true);
+    notify_timer();
 
-    while (false == thread_exited_.load() && thread_) {
-        Log::Sleep(std::chrono::milliseconds(100));
+    if (thread_ && thread_->joinable()) {
+        thread_->join();
     }
 }
 
 void OTCachedKey::Reset() { reset_master_password(); }
 
-void OTCachedKey::reset_timer() const { time_.store(std::time(nullptr)); }
+void OTCachedKey::notify_timer() const
+{
+    Lock lock(timer_lock_);
+    lock.unlock();
+    timer_.notify_all();
+}
+
+void OTCachedKey::reset_timer() const
+{
+    time_.store(std::time(nullptr));
+    notify_timer();
+}
 
 void OTCachedKey::reset_master_password()
 {
@@ -844,31 +858,52 @@ void OTCachedKey::SetTimeoutSeconds(const std::int64_t nTimeoutSeconds)
         "(-1)\n");
 
     timeout_.store(nTimeoutSeconds);
+    notify_timer();
 }
 
 void OTCachedKey::timeout_thread() const
 {
     thread_exited_.store(false);
+    Lock timer(timer_lock_);
 
     while (false == shutdown_.load()) {
-        const auto limit = std::chrono::seconds(timeout_.load());
+        const auto timeout = timeout_.load();
+        const auto lastReset = time_.load();
+        const auto limit = std::chrono::seconds(timeout);
         const auto now = std::chrono::seconds(std::time(nullptr));
-        const auto last = std::chrono::seconds(time_.load());
+        const auto last = std::chrono::seconds(lastReset);
         const auto duration = now - last;
+        // Nothing to do until reset_timer, SetTimeoutSeconds or release_thread
+        const auto changed = [&]() -> bool {
+            return shutdown_.load() || (timeout != timeout_.load()) ||
+                   (lastReset != time_.load());
+        };
 
-        if (limit >= std::chrono::seconds(0)) {
-            if (duration > limit) {
-                if (timeout_.load() != (-1)) {
-                    Lock lock(master_password_lock_);
-                    master_password_.reset();
-                    lock.unlock();
-                }
-            }
+        if (limit < std::chrono::seconds(0)) {
+            timer_.wait(timer, changed);
+
+            continue;
         }
 
-        Log::Sleep(std::chrono::milliseconds(100));
+        if (duration > limit) {
+            // Never hold timer_lock_ while acquiring master_password_lock_,
+            // since GetMasterPassword calls reset_timer in the opposite order.
+            timer.unlock();
+            Lock lock(master_password_lock_);
+            master_password_.reset();
+            lock.unlock();
+            timer.lock();
+            timer_.wait(timer, changed);
+
+            continue;
+        }
+
+        // Sleep until just after the password is due to expire.
+        timer_.wait_for(timer, limit - duration + std::chrono::seconds(1));
     }
 
+    timer.unlock();
+
     Lock lock(master_password_lock_);
     master_password_.reset();
     lock.unlock();
@@ -902,6 +937,7 @@ OTCachedKey::~OTCachedKey()
 {
     Lock lock(general_lock_);
     shutdown_.store(true);
+    notify_timer();
 
     if ((false == thread_exited_.load()) && thread_ && thread_->joinable()) {
         thread_->join();
@@ -262,13 +262,15 @@ bool SymmetricKey::Allocate(
 
 bool SymmetricKey::ChangePassword(
     const OTPasswordData& oldPassword,
-    const OTPassword& newPassword)
+    const OTPassword& newPassword,
+    const std::string& iv)
 {
     if (Unlock(oldPassword)) {
         OTPasswordData password("");
         password.SetOverride(newPassword);
 
-        return EncryptKey(*plaintext_key_, password);
+        return EncryptKey(
+            *plaintext_key_, password, proto::SKEYTYPE_ARGON2, iv);
     }
 
     otErr << OT_METHOD << __FUNCTION__ << ": Unable to unlock master key."
@@ -501,16 +503,24 @@ bool SymmetricKey::Encrypt(
 bool SymmetricKey::EncryptKey(
     const OTPassword& plaintextKey,
     const OTPasswordData& keyPassword,
-    const proto::SymmetricKeyType type)
+    const proto::SymmetricKeyType type,
+    const std::string& iv)
 {
     encrypted_key_.reset(new proto::Ciphertext);
 
     OT_ASSERT(encrypted_key_);
 
     encrypted_key_->set_mode(engine_.DefaultMode());
-    OTPassword blankIV;
-    blankIV.randomizeMemory(engine_.IvSize(encrypted_key_->mode()));
-    encrypted_key_->set_iv(blankIV.getMemory(), blankIV.getMemorySize());
+    const auto ivSize = engine_.IvSize(encrypted_key_->mode());
+
+    if (ivSize <= iv.size()) {
+        encrypted_key_->set_iv(iv.data(), ivSize);
+    } else {
+        OTPassword blankIV;
+        blankIV.randomizeMemory(ivSize);
+        encrypted_key_->set_iv(blankIV.getMemory(), blankIV.getMemorySize());
+    }
+
     encrypted_key_->set_text(false);
     OTPassword key;
     GetPassword(keyPassword, key);
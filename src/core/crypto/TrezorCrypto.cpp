@@ -69,6 +69,8 @@ extern "C" {
 
 #include <stdint.h>
 #include <array>
+#include <memory>
+#include <vector>
 
 #define OT_METHOD "opentxs::TrezorCrypto::"
 
@@ -250,6 +252,56 @@ serializedAsymmetricKey TrezorCrypto::GetHDKey(
     return output;
 }
 
+std::vector<serializedAsymmetricKey> TrezorCrypto::GetHDKeys(
+    const EcdsaCurve& curve,
+    const OTPassword& seed,
+    const proto::HDPath& parent,
+    const std::vector<std::uint32_t>& children) const
+{
+    std::vector<serializedAsymmetricKey> output{};
+    proto::HDPath path = parent;
+    std::shared_ptr<const HDNode> node = DeriveChild(curve, seed, path);
+
+    if (!node) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive parent."
+              << std::endl;
+
+        return output;
+    }
+
+    // Children are finished sequentially: HDNodeToSerialized encrypts the
+    // private key through the shared master key, which is not verified to be
+    // safe for concurrent use.
+    const auto type = CryptoAsymmetric::CurveToKeyType(curve);
+
+    for (const auto& index : children) {
+        auto child = GetChild(*node, index, DERIVE_PRIVATE);
+
+        if (!child) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive child "
+                  << index << "." << std::endl;
+
+            return {};
+        }
+
+        auto key = HDNodeToSerialized(type, *child, DERIVE_PRIVATE);
+
+        if (!key) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize child "
+                  << index << "." << std::endl;
+
+            return {};
+        }
+
+        auto& keyPath = *key->mutable_path();
+        keyPath = parent;
+        keyPath.add_child(index);
+        output.emplace_back(key);
+    }
+
+    return output;
+}
+
 serializedAsymmetricKey TrezorCrypto::HDNodeToSerialized(
     const proto::AsymmetricKeyType& type,
     const HDNode& node,
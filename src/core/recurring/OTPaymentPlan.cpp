@@ -304,7 +304,7 @@ void OTPaymentPlan::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 // *** Set Initial Payment ***  / Make sure to call SetAgreement() first.
@@ -1274,27 +1274,20 @@ std::string OTSmartContract::GetAcctBalance(std::string from_acct_name)
 
     // Load up the party's account so we can get the balance.
     //
-    Account* pPartyAssetAcct =
-        Account::LoadExistingAccount(PARTY_ACCT_ID, NOTARY_ID);
+    // (load_account verifies the server's signature.)
+    auto pPartyAssetAcct = load_account(PARTY_ACCT_ID, NOTARY_ID, *pServerNym);
 
-    if (nullptr == pPartyAssetAcct) {
+    if (!pPartyAssetAcct) {
         otOut << "OTSmartContract::GetAcctBalance: ERROR verifying existence "
                  "of source account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return 0;
-    } else if (!pPartyAssetAcct->VerifySignature(*pServerNym)) {
-        otOut << "OTSmartContract::GetAcctBalance: ERROR failed to verify the "
-                 "server's signature on the party's account.\n";
-        FlagForRemoval();  // Remove it from future Cron processing, please.
-        return 0;
     } else if (!pPartyAssetAcct->VerifyOwnerByID(PARTY_NYM_ID)) {
         otOut << "OTSmartContract::GetAcctBalance: ERROR failed to verify "
                  "party user ownership of party account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return 0;
     }
-    // Past this point we know pPartyAssetAcct is good and will clean itself up.
-    std::unique_ptr<Account> theSourceAcctSmrtPtr(pPartyAssetAcct);
 
     String strBalance;
     strBalance.Format("%" PRId64, pPartyAssetAcct->GetBalance());
@@ -1502,21 +1495,15 @@ std::string OTSmartContract::GetInstrumentDefinitionIDofAcct(
 
     // Load up the party's account and get the instrument definition.
     //
-    Account* pPartyAssetAcct =
-        Account::LoadExistingAccount(PARTY_ACCT_ID, NOTARY_ID);
+    // (load_account verifies the server's signature.)
+    auto pPartyAssetAcct = load_account(PARTY_ACCT_ID, NOTARY_ID, *pServerNym);
 
-    if (nullptr == pPartyAssetAcct) {
+    if (!pPartyAssetAcct) {
         otOut << "OTSmartContract::GetInstrumentDefinitionIDofAcct: ERROR "
                  "verifying "
                  "existence of source account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return str_return_value;
-    } else if (!pPartyAssetAcct->VerifySignature(*pServerNym)) {
-        otOut << "OTSmartContract::GetInstrumentDefinitionIDofAcct: ERROR "
-                 "failed to "
-                 "verify the server's signature on the party's account.\n";
-        FlagForRemoval();  // Remove it from future Cron processing, please.
-        return str_return_value;
     } else if (!pPartyAssetAcct->VerifyOwnerByID(PARTY_NYM_ID)) {
         otOut << "OTSmartContract::GetInstrumentDefinitionIDofAcct: ERROR "
                  "failed to "
@@ -1524,8 +1511,6 @@ std::string OTSmartContract::GetInstrumentDefinitionIDofAcct(
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return str_return_value;
     }
-    // Past this point we know pPartyAssetAcct is good and will clean itself up.
-    std::unique_ptr<Account> theSourceAcctSmrtPtr(pPartyAssetAcct);
 
     const String strInstrumentDefinitionID(
         pPartyAssetAcct->GetInstrumentDefinitionID());
@@ -2265,27 +2250,20 @@ bool OTSmartContract::StashFunds(
     // which
     // stash to get off the stash.
     //
-    Account* pPartyAssetAcct =
-        Account::LoadExistingAccount(PARTY_ACCT_ID, NOTARY_ID);
+    // (load_account verifies the server's signature.)
+    auto pPartyAssetAcct = load_account(PARTY_ACCT_ID, NOTARY_ID, *pServerNym);
 
-    if (nullptr == pPartyAssetAcct) {
+    if (!pPartyAssetAcct) {
         otOut << "OTSmartContract::StashFunds: ERROR verifying existence of "
                  "source account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return false;
-    } else if (!pPartyAssetAcct->VerifySignature(*pServerNym)) {
-        otOut << "OTSmartContract::StashFunds: ERROR failed to verify the "
-                 "server's signature on the party's account.\n";
-        FlagForRemoval();  // Remove it from future Cron processing, please.
-        return false;
     } else if (!pPartyAssetAcct->VerifyOwnerByID(PARTY_NYM_ID)) {
         otOut << "OTSmartContract::StashFunds: ERROR failed to verify party "
                  "user ownership of party account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return false;
     }
-    // Past this point we know pPartyAssetAcct is good and will clean itself up.
-    std::unique_ptr<Account> theSourceAcctSmrtPtr(pPartyAssetAcct);
 
     //
     // There could be many stashes, each with a name. (One was passed in
@@ -2389,6 +2367,8 @@ bool OTSmartContract::StashFunds(
                     "pointer (should never happen.)\n");
     }
 
+    add_stash_account(pStashAccount);
+
     // This code is similar to above, but it checks the stash ACCT itself
     // instead of the stash entry.
     //
@@ -2586,31 +2566,18 @@ bool OTSmartContract::StashFunds(
         // inbox.
         // (No need for the stash's inbox -- the server owns it.)
 
-        // Load the inbox in case it already exists
-        Ledger thePartyInbox(PARTY_NYM_ID, PARTY_ACCT_ID, NOTARY_ID);
-
-        // ALL inboxes -- no outboxes. All will receive notification of
-        // something ALREADY DONE.
-        bool bSuccessLoadingPartyInbox = thePartyInbox.LoadInbox();
+        // Load the inbox. ALL inboxes -- no outboxes. All will receive
+        // notification of something ALREADY DONE.
+        // (load_inbox also verifies it against the server nym.)
+        auto pPartyInbox = load_inbox(
+            PARTY_NYM_ID, PARTY_ACCT_ID, NOTARY_ID, *pServerNym);
 
-        // ...or generate them otherwise...
-
-        if (true == bSuccessLoadingPartyInbox)
-            bSuccessLoadingPartyInbox =
-                thePartyInbox.VerifyAccount(*pServerNym);
-        else
-            otErr << "OTSmartContract::StashFunds: Failed trying to load "
-                     "party's inbox.\n";
-        //            OT_FAIL_MSG("ASSERT:  TRYING TO GENERATE INBOX IN STASH
-        // FUNDS!!!\n");
-        //            bSuccessLoadingPartyInbox        =
-        // thePartyInbox.GenerateLedger(PARTY_ACCT_ID, NOTARY_ID,
-        // OTLedger::inbox, true); // bGenerateFile=true
-
-        if (!bSuccessLoadingPartyInbox) {
+        if (!pPartyInbox) {
             otErr << "OTSmartContract::StashFunds: ERROR loading or generating "
                      "inbox ledger.\n";
         } else {
+            auto& thePartyInbox = *pPartyInbox;
+
             // Generate new transaction numbers for these new transactions
             std::int64_t lNewTransactionNumber =
                 pCron->GetNextTransactionNumber();
@@ -2996,19 +2963,11 @@ bool OTSmartContract::StashFunds(
 
             thePartyInbox.AddTransaction(*pTransParty);
 
-            // Release any signatures that were there before (They won't
-            // verify anymore anyway, since the content has changed.)
-            //
-            thePartyInbox.ReleaseSignatures();
-            thePartyInbox.SignContract(*pServerNym);
-            thePartyInbox.SaveContract();
-
-            pPartyAssetAcct->SaveInbox(thePartyInbox);
-
-            // This corresponds to the AddTransaction() call just above.
-            // These are stored in a separate file now.
-            //
-            pTransParty->SaveBoxReceipt(thePartyInbox);
+            // Sign and save the inbox, and the box receipt for the
+            // AddTransaction() call just above. (These are stored in a
+            // separate file now.)
+            save_inbox(
+                *pPartyAssetAcct, thePartyInbox, *pTransParty, *pServerNym);
 
             // If success, save the accounts with new balance. (Save inboxes
             // with receipts either way,
@@ -3017,26 +2976,9 @@ bool OTSmartContract::StashFunds(
             //
             if (true == bSuccess) {
                 // SAVE THE ACCOUNTS.
-
-                // Release any signatures that were there before (They won't
-                // verify anymore anyway, since the content has changed.)
-                //
-                pPartyAssetAcct->ReleaseSignatures();
-                pStashAccount->ReleaseSignatures();
-
-                // Sign both of them.
-                pPartyAssetAcct->SignContract(*pServerNym);
-                pStashAccount->SignContract(*pServerNym);
-
-                // Save both of them internally
-                pPartyAssetAcct->SaveContract();
-                pStashAccount->SaveContract();
-
                 // TODO: Better rollback capabilities in case of failures here:
-
-                // Save both accounts to storage.
-                pPartyAssetAcct->SaveAccount();
-                pStashAccount->SaveAccount();
+                save_account(*pPartyAssetAcct, *pServerNym);
+                save_account(*pStashAccount, *pServerNym);
                 // NO NEED TO LOG HERE, since success / failure is already
                 // logged above.
             }
@@ -3049,12 +2991,10 @@ bool OTSmartContract::StashFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    pCron->SaveCron();  // TODO No need to call this here if I can make sure
-                        // it's being called higher up somewhere
-    // (Imagine a script that has 10 account moves in it -- maybe don't need to
-    // save cron until
-    // after all 10 are done. Or maybe DO need to do in between. Todo research
-    // this. Optimization.)
+    // (Imagine a script that has 10 account moves in it -- while clauses are
+    // executing, cron is only saved once, after all 10 are done.)
+    save_cron();
+
     return bSuccess;
 }
 
@@ -3703,6 +3643,13 @@ void OTSmartContract::ExecuteClauses(
                      // single
                      // param.
 {
+    // The accounts and inboxes used by these clauses are loaded once, and
+    // saved once after the last clause has run. (Unless a clause is already
+    // executing further up the stack, in which case that one commits.)
+    const bool bOwnsWorkingSet = !working_set_active_;
+
+    if (bOwnsWorkingSet) begin_working_set();
+
     // Loop through the clauses passed in, and execute them all.
     for (auto& it_clauses : theClauses) {
         const std::string str_clause_name = it_clauses.first;
@@ -3832,17 +3779,16 @@ void OTSmartContract::ExecuteClauses(
         }
     }
 
+    if (bOwnsWorkingSet) commit_working_set();
+
     // "Important" variables.
     // (If any of them have changed, then I need to notice the parties.)
     //
     // TODO: Fix IsDirtyImportant() so that it checks for changed STASHES
     // as well. (Or have another function to do it, which is also called here.)
     //
-    // I'd like to get to where I can just call IsDirty() here, and then SAVE
-    // CRON HERE,
-    // so I'm not having to save it after EACH change, which is currently
-    // occuring in the
-    // StashAcctFunds / MoveAcctFunds functions. Todo.
+    // (Cron itself is saved by commit_working_set() above, once, if any
+    // StashAcctFunds / MoveAcctFunds call changed it.)
     //
     if (IsDirtyImportant())  // This tells us if any "Important" variables
                              // have changed since executing the scripts.
@@ -3885,6 +3831,211 @@ void OTSmartContract::ExecuteClauses(
     }
 }
 
+void OTSmartContract::begin_working_set()
+{
+    working_set_active_ = true;
+    working_cron_dirty_ = false;
+    working_set_.clear();
+}
+
+// Everything the clauses changed is signed and saved here, once per file,
+// in the same order the old per-call code used: inbox, box receipts, then
+// the account (whose inbox hash the new inbox has just changed.)
+void OTSmartContract::commit_working_set()
+{
+    OTCron* pCron = GetCron();
+    OT_ASSERT(nullptr != pCron);
+
+    Nym* pServerNym = pCron->GetServerNym();
+    OT_ASSERT(nullptr != pServerNym);
+
+    working_set_active_ = false;
+
+    for (auto& it : working_set_) {
+        auto& working = it.second;
+
+        if (!working.account_) {
+            otErr << "OTSmartContract::commit_working_set: Inbox loaded "
+                     "without its account: "
+                  << it.first << "\n";
+            continue;
+        }
+
+        if (working.inbox_ && (false == working.receipts_.empty())) {
+            auto& inbox = *working.inbox_;
+            inbox.ReleaseSignatures();
+            inbox.SignContract(*pServerNym);
+            inbox.SaveContract();
+            working.account_->SaveInbox(inbox);
+
+            for (auto& pReceipt : working.receipts_) {
+                pReceipt->SaveBoxReceipt(inbox);
+            }
+
+            working.dirty_ = true;
+        }
+
+        if (working.dirty_) {
+            auto& account = *working.account_;
+            account.ReleaseSignatures();
+            account.SignContract(*pServerNym);
+            account.SaveContract();
+            account.SaveAccount();
+        }
+    }
+
+    working_set_.clear();
+
+    if (working_cron_dirty_) {
+        working_cron_dirty_ = false;
+        pCron->SaveCron();
+    }
+}
+
+// Loads the account and verifies the server's signature on it. While the
+// working set is active, the same copy is returned for the rest of the
+// clauses, since its signature only becomes valid again once it's saved.
+std::shared_ptr<Account> OTSmartContract::load_account(
+    const Identifier& accountID,
+    const Identifier& notaryID,
+    const Nym& serverNym)
+{
+    const std::string strAccountID(String(accountID).Get());
+
+    if (working_set_active_) {
+        auto it = working_set_.find(strAccountID);
+
+        if ((working_set_.end() != it) && it->second.account_) {
+            return it->second.account_;
+        }
+    }
+
+    std::shared_ptr<Account> pAccount(
+        Account::LoadExistingAccount(accountID, notaryID));
+
+    if (!pAccount) return pAccount;
+
+    if (!pAccount->VerifySignature(serverNym)) {
+        otOut << "OTSmartContract::load_account: ERROR failed to verify the "
+                 "server's signature on account: "
+              << strAccountID << "\n";
+
+        return {};
+    }
+
+    if (working_set_active_) working_set_[strAccountID].account_ = pAccount;
+
+    return pAccount;
+}
+
+std::shared_ptr<Ledger> OTSmartContract::load_inbox(
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const Identifier& notaryID,
+    const Nym& serverNym)
+{
+    const std::string strAccountID(String(accountID).Get());
+
+    if (working_set_active_) {
+        auto it = working_set_.find(strAccountID);
+
+        if ((working_set_.end() != it) && it->second.inbox_) {
+            return it->second.inbox_;
+        }
+    }
+
+    std::shared_ptr<Ledger> pInbox(new Ledger(nymID, accountID, notaryID));
+    OT_ASSERT(pInbox);
+
+    if (!pInbox->LoadInbox()) {
+        otErr << "OTSmartContract::load_inbox: ERROR loading inbox ledger "
+                 "for account: "
+              << strAccountID << "\n";
+
+        return {};
+    }
+
+    if (!pInbox->VerifyAccount(serverNym)) {
+        otErr << "OTSmartContract::load_inbox: ERROR verifying inbox ledger "
+                 "for account: "
+              << strAccountID << "\n";
+
+        return {};
+    }
+
+    if (working_set_active_) working_set_[strAccountID].inbox_ = pInbox;
+
+    return pInbox;
+}
+
+// Stash accounts come from m_StashAccts, which only keeps weak pointers.
+// Holding them here keeps every stash call on the same copy.
+void OTSmartContract::add_stash_account(
+    const std::shared_ptr<Account>& account)
+{
+    if (!working_set_active_ || !account) return;
+
+    auto& working = working_set_[String(account->GetRealAccountID()).Get()];
+
+    if (!working.account_) working.account_ = account;
+}
+
+void OTSmartContract::save_account(Account& account, const Nym& serverNym)
+{
+    if (working_set_active_) {
+        auto it = working_set_.find(String(account.GetRealAccountID()).Get());
+
+        if ((working_set_.end() != it) &&
+            (it->second.account_.get() == &account)) {
+            it->second.dirty_ = true;
+
+            return;
+        }
+    }
+
+    account.ReleaseSignatures();
+    account.SignContract(serverNym);
+    account.SaveContract();
+    account.SaveAccount();
+}
+
+// The receipt must already have been added to the inbox.
+void OTSmartContract::save_inbox(
+    Account& account,
+    Ledger& inbox,
+    OTTransaction& receipt,
+    const Nym& serverNym)
+{
+    if (working_set_active_) {
+        auto it = working_set_.find(String(account.GetRealAccountID()).Get());
+
+        if ((working_set_.end() != it) &&
+            (it->second.inbox_.get() == &inbox)) {
+            it->second.receipts_.push_back(&receipt);
+
+            return;
+        }
+    }
+
+    inbox.ReleaseSignatures();
+    inbox.SignContract(serverNym);
+    inbox.SaveContract();
+    account.SaveInbox(inbox);
+    receipt.SaveBoxReceipt(inbox);
+}
+
+void OTSmartContract::save_cron()
+{
+    if (working_set_active_) {
+        working_cron_dirty_ = true;
+    } else {
+        OTCron* pCron = GetCron();
+        OT_ASSERT(nullptr != pCron);
+
+        pCron->SaveCron();
+    }
+}
+
 // The server calls this when it wants to know if a certain party is allowed to
 // cancel
 // the entire contract (remove it from Cron).
@@ -5443,7 +5594,7 @@ void OTSmartContract::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 // Used internally here.
@@ -6049,29 +6200,25 @@ bool OTSmartContract::MoveFunds(
 
     // LOAD THE ACCOUNTS
     //
-    Account* pSourceAcct =
-        Account::LoadExistingAccount(SOURCE_ACCT_ID, NOTARY_ID);
+    // (load_account also verifies the server's signature on each.)
+    auto pSourceAcct = load_account(SOURCE_ACCT_ID, NOTARY_ID, *pServerNym);
 
-    if (nullptr == pSourceAcct) {
+    if (!pSourceAcct) {
         otOut << "OTCronItem::MoveFunds: ERROR verifying existence of source "
                  "account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return false;
     }
-    // Past this point we know pSourceAcct is good and will clean itself up.
-    std::unique_ptr<Account> theSourceAcctSmrtPtr(pSourceAcct);
 
-    Account* pRecipientAcct =
-        Account::LoadExistingAccount(RECIPIENT_ACCT_ID, NOTARY_ID);
+    auto pRecipientAcct =
+        load_account(RECIPIENT_ACCT_ID, NOTARY_ID, *pServerNym);
 
-    if (nullptr == pRecipientAcct) {
+    if (!pRecipientAcct) {
         otOut << "OTCronItem::MoveFunds: ERROR verifying existence of "
                  "recipient account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return false;
     }
-    // Past this point we know pRecipientAcct is good and will clean itself up.
-    std::unique_ptr<Account> theRecipAcctSmrtPtr(pRecipientAcct);
 
     // BY THIS POINT, both accounts are successfully loaded, and I don't have to
     // worry about
@@ -6095,19 +6242,15 @@ bool OTSmartContract::MoveFunds(
         return false;
     }
 
-    // I call VerifySignature (WITH SERVER NYM) here since VerifyContractID was
-    // already called in LoadExistingAccount().
+    // The server's signature (WITH SERVER NYM) was already verified in
+    // load_account(), and VerifyContractID in LoadExistingAccount().
     //
-    else if (
-        !pSourceAcct->VerifySignature(*pServerNym) ||
-        !VerifyNymAsAgentForAccount(*pSenderNym, *pSourceAcct)) {
+    else if (!VerifyNymAsAgentForAccount(*pSenderNym, *pSourceAcct)) {
         otOut << "OTCronItem::MoveFunds: ERROR verifying signature or "
                  "ownership on source account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
         return false;
-    } else if (
-        !pRecipientAcct->VerifySignature(*pServerNym) ||
-        !VerifyNymAsAgentForAccount(*pRecipientNym, *pRecipientAcct)) {
+    } else if (!VerifyNymAsAgentForAccount(*pRecipientNym, *pRecipientAcct)) {
         otOut << "OTCronItem::MoveFunds: ERROR verifying signature or "
                  "ownership on recipient account.\n";
         FlagForRemoval();  // Remove it from future Cron processing, please.
@@ -6126,44 +6269,21 @@ bool OTSmartContract::MoveFunds(
         // inbox and the recipient's inbox.
         // IF they can be loaded up from file, or generated, that is.
 
-        // Load the inboxes in case they already exist
-        Ledger theSenderInbox(SENDER_NYM_ID, SOURCE_ACCT_ID, NOTARY_ID),
-            theRecipientInbox(RECIPIENT_NYM_ID, RECIPIENT_ACCT_ID, NOTARY_ID);
-
-        // ALL inboxes -- no outboxes. All will receive notification of
-        // something ALREADY DONE.
-        bool bSuccessLoadingSenderInbox = theSenderInbox.LoadInbox();
-        bool bSuccessLoadingRecipientInbox = theRecipientInbox.LoadInbox();
+        // Load the inboxes. ALL inboxes -- no outboxes. All will receive
+        // notification of something ALREADY DONE.
+        // (load_inbox also verifies them against the server nym.)
+        auto pSenderInbox = load_inbox(
+            SENDER_NYM_ID, SOURCE_ACCT_ID, NOTARY_ID, *pServerNym);
+        auto pRecipientInbox = load_inbox(
+            RECIPIENT_NYM_ID, RECIPIENT_ACCT_ID, NOTARY_ID, *pServerNym);
 
-        // ...or generate them otherwise...
-
-        if (true == bSuccessLoadingSenderInbox)
-            bSuccessLoadingSenderInbox =
-                theSenderInbox.VerifyAccount(*pServerNym);
-        else
-            otErr << "OTCronItem::MoveFunds: ERROR loading sender inbox "
-                     "ledger.\n";
-        //        else
-        //            bSuccessLoadingSenderInbox        =
-        // theSenderInbox.GenerateLedger(SOURCE_ACCT_ID, NOTARY_ID,
-        // OTLedger::inbox, true); // bGenerateFile=true
-
-        if (true == bSuccessLoadingRecipientInbox)
-            bSuccessLoadingRecipientInbox =
-                theRecipientInbox.VerifyAccount(*pServerNym);
-        else
-            otErr << "OTCronItem::MoveFunds: ERROR loading recipient inbox "
-                     "ledger.\n";
-        //        else
-        //            bSuccessLoadingRecipientInbox    =
-        // theRecipientInbox.GenerateLedger(RECIPIENT_ACCT_ID, NOTARY_ID,
-        // OTLedger::inbox, true); // bGenerateFile=true
-
-        if ((false == bSuccessLoadingSenderInbox) ||
-            (false == bSuccessLoadingRecipientInbox)) {
+        if (!pSenderInbox || !pRecipientInbox) {
             otErr << "OTCronItem::MoveFunds: ERROR loading or generating one "
                      "(or both) of the inbox ledgers.\n";
         } else {
+            auto& theSenderInbox = *pSenderInbox;
+            auto& theRecipientInbox = *pRecipientInbox;
+
             // Generate new transaction numbers for these new transactions
             std::int64_t lNewTransactionNumber =
                 GetCron()->GetNextTransactionNumber();
@@ -6465,52 +6585,21 @@ bool OTSmartContract::MoveFunds(
             theSenderInbox.AddTransaction(*pTransSend);
             theRecipientInbox.AddTransaction(*pTransRecip);
 
-            // Release any signatures that were there before (They won't
-            // verify anymore anyway, since the content has changed.)
-            theSenderInbox.ReleaseSignatures();
-            theRecipientInbox.ReleaseSignatures();
-
-            // Sign both of them.
-            theSenderInbox.SignContract(*pServerNym);
-            theRecipientInbox.SignContract(*pServerNym);
-
-            // Save both of them internally
-            theSenderInbox.SaveContract();
-            theRecipientInbox.SaveContract();
-
-            // Save both inboxes to storage. (File, DB, wherever it goes.)
-            pSourceAcct->SaveInbox(theSenderInbox);
-            pRecipientAcct->SaveInbox(theRecipientInbox);
-
-            // These correspond to the AddTransaction() calls, just above
-            //
-            pTransSend->SaveBoxReceipt(theSenderInbox);
-            pTransRecip->SaveBoxReceipt(theRecipientInbox);
+            // Sign and save both inboxes, along with the box receipts that
+            // correspond to the AddTransaction() calls just above. (While
+            // clauses are executing, this happens once they've all finished.)
+            save_inbox(*pSourceAcct, theSenderInbox, *pTransSend, *pServerNym);
+            save_inbox(
+                *pRecipientAcct, theRecipientInbox, *pTransRecip, *pServerNym);
 
             // If success, save the accounts with new balance. (Save inboxes
             // with receipts either way,
             // and the receipts will contain a rejection or acknowledgment
             // stamped by the Server Nym.)
             if (true == bSuccess) {
-
-                // Release any signatures that were there before (They won't
-                // verify anymore anyway, since the content has changed.)
-                pSourceAcct->ReleaseSignatures();
-                pRecipientAcct->ReleaseSignatures();
-
-                // Sign both of them.
-                pSourceAcct->SignContract(*pServerNym);
-                pRecipientAcct->SignContract(*pServerNym);
-
-                // Save both of them internally
-                pSourceAcct->SaveContract();
-                pRecipientAcct->SaveContract();
-
                 // TODO: Better rollback capabilities in case of failures here:
-
-                // Save both accounts to storage.
-                pSourceAcct->SaveAccount();
-                pRecipientAcct->SaveAccount();
+                save_account(*pSourceAcct, *pServerNym);
+                save_account(*pRecipientAcct, *pServerNym);
 
                 // NO NEED TO LOG HERE, since success / failure is already
                 // logged above.
@@ -6526,7 +6615,7 @@ bool OTSmartContract::MoveFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    save_cron();
 
     return bSuccess;
 }
@@ -214,7 +214,7 @@ void OTMarket::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 int64_t OTMarket::GetTotalAvailableAssets()
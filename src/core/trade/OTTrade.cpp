@@ -290,7 +290,7 @@ void OTTrade::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 // The trade stores a copy of the Offer in string form.
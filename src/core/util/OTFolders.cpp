@@ -53,6 +53,7 @@
 #define DEFAULT_NYM "nyms"
 #define DEFAULT_NYMBOX "nymbox"
 #define DEFAULT_OUTBOX "outbox"
+#define DEFAULT_OUTPAYMENTS "outpayments"
 #define DEFAULT_PAYMENTINBOX "paymentInbox"
 #define DEFAULT_PURSE "purse"
 #define DEFAULT_RECEIPT "receipts"
@@ -74,6 +75,7 @@
 #define KEY_NYM "nym"
 #define KEY_NYMBOX "nymbox"
 #define KEY_OUTBOX "outbox"
+#define KEY_OUTPAYMENTS "outpayments"
 #define KEY_PAYMENTINBOX "paymentinbox"
 #define KEY_PURSE "purse"
 #define KEY_RECEIPT "receipt"
@@ -98,6 +100,7 @@ String OTFolders::s_strMint("");
 String OTFolders::s_strNym("");
 String OTFolders::s_strNymbox("");
 String OTFolders::s_strOutbox("");
+String OTFolders::s_strOutpayments("");
 String OTFolders::s_strPaymentInbox("");
 String OTFolders::s_strPurse("");
 String OTFolders::s_strReceipt("");
@@ -138,6 +141,9 @@ bool OTFolders::GetSetAll()
         return false;
     if (!GetSetFolderName(config, KEY_OUTBOX, DEFAULT_OUTBOX, s_strOutbox))
         return false;
+    if (!GetSetFolderName(
+            config, KEY_OUTPAYMENTS, DEFAULT_OUTPAYMENTS, s_strOutpayments))
+        return false;
     if (!GetSetFolderName(
             config, KEY_PAYMENTINBOX, DEFAULT_PAYMENTINBOX, s_strPaymentInbox))
         return false;
@@ -183,6 +189,7 @@ const String& OTFolders::Mint() { return GetFolder(s_strMint); }
 const String& OTFolders::Nym() { return GetFolder(s_strNym); }
 const String& OTFolders::Nymbox() { return GetFolder(s_strNymbox); }
 const String& OTFolders::Outbox() { return GetFolder(s_strOutbox); }
+const String& OTFolders::Outpayments() { return GetFolder(s_strOutpayments); }
 const String& OTFolders::PaymentInbox() { return GetFolder(s_strPaymentInbox); }
 const String& OTFolders::Purse() { return GetFolder(s_strPurse); }
 const String& OTFolders::Receipt() { return GetFolder(s_strReceipt); }
@@ -54,7 +54,9 @@
 #include <sys/stat.h>
 #include <cerrno>
 #include <cstdlib>
+#include <mutex>
 #include <ostream>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -125,6 +127,9 @@ String OTPaths::s_strGlobalConfigFile("");
 String OTPaths::s_strPrefixFolder("");
 String OTPaths::s_strScriptsFolder("");
 
+std::mutex OTPaths::s_folderLock;
+std::set<std::string> OTPaths::s_knownFolders;
+
 OTPaths::~OTPaths() {}
 
 const String& OTPaths::AppBinaryFolder()
@@ -849,7 +854,8 @@ bool OTPaths::FolderExists(const String& strFolderPath)
 bool OTPaths::ConfirmCreateFolder(
     const String& strExactPath,
     bool& out_Exists,
-    bool& out_IsNew)
+    bool& out_IsNew,
+    const bool bUseCache)
 {
     const bool bExists = (strExactPath.Exists() && !strExactPath.Compare(""));
     OT_ASSERT_MSG(
@@ -860,10 +866,17 @@ bool OTPaths::ConfirmCreateFolder(
 
     if ('/' != *l_strExactPath.rbegin()) return false;  // not a directory.
 
+    if (bUseCache && IsKnownFolder(l_strExactPath)) {
+        out_Exists = true;
+        out_IsNew = false;
+        return true;
+    }
+
     // Confirm If Directory Exists Already
     out_Exists = PathExists(strExactPath);
 
     if (out_Exists) {
+        RememberFolder(l_strExactPath);
         out_IsNew = false;
         return true;  // Already Have Folder, lets return true!
     } else {
@@ -901,6 +914,7 @@ bool OTPaths::ConfirmCreateFolder(
                 out_Exists = false;
                 return false;
             } else {
+                RememberFolder(l_strExactPath);
                 out_IsNew = true;
                 out_Exists = false;
                 return true;  // We have created and checked the Folder
@@ -909,6 +923,21 @@ bool OTPaths::ConfirmCreateFolder(
     }
 }
 
+// static
+bool OTPaths::IsKnownFolder(const std::string& strExactPath)
+{
+    std::lock_guard<std::mutex> lock(s_folderLock);
+
+    return (0 < s_knownFolders.count(strExactPath));
+}
+
+// static
+void OTPaths::RememberFolder(const std::string& strExactPath)
+{
+    std::lock_guard<std::mutex> lock(s_folderLock);
+    s_knownFolders.insert(strExactPath);
+}
+
 // static
 bool OTPaths::ToReal(const String& strExactPath, String& out_strCanonicalPath)
 {
@@ -1181,10 +1210,21 @@ bool OTPaths::RelativeToCanonical(
 // static
 bool OTPaths::BuildFolderPath(
     const String& strFolderPath,
-    bool& out_bFolderCreated)
+    bool& out_bFolderCreated,
+    const bool bUseCache)
 {
     out_bFolderCreated = false;
 
+    // A path which was built before is answered without resolving it again,
+    // since ToReal and the per-folder checks each touch every component.
+    std::string l_strRequested(strFolderPath.Get());
+
+    if (!l_strRequested.empty() && ('/' != *l_strRequested.rbegin())) {
+        l_strRequested += "/";
+    }
+
+    if (bUseCache && IsKnownFolder(l_strRequested)) return true;
+
     String l_strFolderPath_fix(""), l_strFolderPath_real("");
 
     if (!ToReal(strFolderPath, l_strFolderPath_real))
@@ -1217,7 +1257,8 @@ bool OTPaths::BuildFolderPath(
 
         String strPathPart(l_strPathPart);
 
-        if (!ConfirmCreateFolder(strPathPart, l_FolderExists, l_bBuiltFolder))
+        if (!ConfirmCreateFolder(
+                strPathPart, l_FolderExists, l_bBuiltFolder, bUseCache))
             return false;
         if (bLog && l_bBuiltFolder)
             otInfo << OT_METHOD << __FUNCTION__
@@ -1225,13 +1266,17 @@ bool OTPaths::BuildFolderPath(
 
         if (!out_bFolderCreated && l_bBuiltFolder) out_bFolderCreated = true;
     }
+
+    RememberFolder(l_strRequested);
+
     return true;
 }
 
 // static
 bool OTPaths::BuildFilePath(
     const String& strFolderPath,
-    bool& out_bFolderCreated)
+    bool& out_bFolderCreated,
+    const bool bUseCache)
 {
     out_bFolderCreated = false;
 
@@ -1270,7 +1315,8 @@ bool OTPaths::BuildFilePath(
         if (0 == i) continue;  // / or x:/ should be skiped.
 
         String strPathPart(l_strPathPart);
-        if (!ConfirmCreateFolder(strPathPart, l_FolderExists, l_bBuiltFolder))
+        if (!ConfirmCreateFolder(
+                strPathPart, l_FolderExists, l_bBuiltFolder, bUseCache))
             return false;
         if (bLog && l_bBuiltFolder)
             otOut << __FUNCTION__ << ": Made new folder: " << l_strPathPart
@@ -66,32 +66,71 @@ void Tag::add_attribute(
     attributes_.insert(temp);
 }
 
-void Tag::output(std::string& str_output) const { outputXML(str_output); }
-
-void Tag::outputXML(std::string& str_output) const
+// Exact number of bytes outputXML will append for this tag and its children.
+std::size_t Tag::output_size() const
 {
-    str_output += ("<" + name_);
+    std::size_t size = name_.size() + 1;  // "<" + name_
+
+    for (auto& kv : attributes_) {
+        // "\n " + key + "=\"" + value + "\""
+        size += kv.first.size() + kv.second.size() + 5;
+    }
+
+    if (text_.empty() && tags_.empty()) {
+
+        return size + 4;  // " />\n"
+    }
 
-    if (!attributes_.empty()) {
-        for (auto& kv : attributes_) {
-            str_output += ("\n " + kv.first + "=\"" + kv.second + "\"");
+    size += 2;  // ">\n"
+
+    if (!text_.empty()) {
+        size += text_.size();
+    } else {
+        for (auto& tag : tags_) {
+            size += tag->output_size();
         }
     }
 
+    return size + name_.size() + 5;  // "\n</" + name_ + ">\n"
+}
+
+void Tag::output(std::string& str_output) const
+{
+    str_output.reserve(str_output.size() + output_size());
+    outputXML(str_output);
+}
+
+// Appends to str_output in place. Callers should reserve output_size() first
+// (output() does) so the document is built in a single allocation.
+void Tag::outputXML(std::string& str_output) const
+{
+    str_output.push_back('<');
+    str_output.append(name_);
+
+    for (auto& kv : attributes_) {
+        str_output.append("\n ", 2);
+        str_output.append(kv.first);
+        str_output.append("=\"", 2);
+        str_output.append(kv.second);
+        str_output.push_back('"');
+    }
+
     if (text_.empty() && tags_.empty()) {
-        str_output += " />\n";
+        str_output.append(" />\n", 4);
     } else {
-        str_output += ">\n";
+        str_output.append(">\n", 2);
 
         if (!text_.empty()) {
-            str_output += text_;
+            str_output.append(text_);
         } else if (!tags_.empty()) {
             for (auto& kv : tags_) {
-                kv->output(str_output);
+                kv->outputXML(str_output);
             }
         }
 
-        str_output += ("\n</" + name_ + ">\n");
+        str_output.append("\n</", 3);
+        str_output.append(name_);
+        str_output.append(">\n", 2);
     }
 }
 
@@ -1951,7 +1951,7 @@ void OTPayment::UpdateContents()
     std::string str_result;
     tag.output(str_result);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    m_xmlUnsigned.Concatenate(str_result);
 }
 
 int32_t OTPayment::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
@@ -145,7 +145,7 @@ bool MainFile::SaveMainFileToString(String& strMainFile)
     std::string str_result;
     tag.output(str_result);
 
-    strMainFile.Concatenate("%s", str_result.c_str());
+    strMainFile.Concatenate(str_result);
 
     return true;
 }
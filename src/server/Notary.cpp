@@ -83,10 +83,12 @@
 #include <cstdint>
 #include <deque>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::Notary::"
 
@@ -98,6 +100,15 @@ typedef std::list<Account*> listOfAccounts;
 typedef std::deque<Token*> dequeOfTokenPtrs;
 #endif  // OT_CASH
 
+// The sender's boxes touched by transfers accepted in a single processInbox,
+// held in memory until the request is committed.
+struct SenderBoxes {
+    std::unique_ptr<Ledger> inbox_{nullptr};
+    std::unique_ptr<Ledger> outbox_{nullptr};
+    std::set<TransactionNumber> removed_{};
+    std::vector<OTTransaction*> added_{};
+};
+
 Notary::Notary(
     Server& server,
     const opentxs::api::Server& mint,
@@ -7219,10 +7230,8 @@ void Notary::NotarizeTransaction(
     bool& bOutSuccess)
 {
     const int64_t lTransactionNumber = tranIn.GetTransactionNum();
-    const Identifier NOTARY_ID(server_.m_strNotaryID);
-    Identifier NYM_ID;
-    theNym.GetIdentifier(NYM_ID);
-    const String strIDNym(NYM_ID);
+    const auto& NOTARY_ID = server_.GetServerID();
+    const auto& NYM_ID = theNym.ID();
     Account theFromAccount(NYM_ID, tranIn.GetPurportedAccountID(), NOTARY_ID);
 
     // Make sure the "from" account even exists...
@@ -7268,7 +7277,7 @@ void Notary::NotarizeTransaction(
             0,
             "%s: Error verifying account ownership... Nym: %s  Acct: %s\n",
             __FUNCTION__,
-            strIDNym.Get(),
+            String(NYM_ID).Get(),
             strIDAcct.Get());
     }
     // Make sure I, the server, have signed this file.
@@ -7279,7 +7288,7 @@ void Notary::NotarizeTransaction(
             "%s: Error verifying server signature on account: %s for Nym: %s\n",
             __FUNCTION__,
             strIDAcct.Get(),
-            strIDNym.Get());
+            String(NYM_ID).Get());
     }
     // No need to call VerifyAccount() here since the above calls go above and
     // beyond that method.
@@ -7294,7 +7303,7 @@ void Notary::NotarizeTransaction(
             "Nym: %s Account: %s\n",
             __FUNCTION__,
             lTransactionNumber,
-            strIDNym.Get(),
+            String(NYM_ID).Get(),
             strIDAcct.Get());
     }
 
@@ -7315,7 +7324,7 @@ void Notary::NotarizeTransaction(
             "Nym: %s  Account: %s\n",
             __FUNCTION__,
             lTransactionNumber,
-            strIDNym.Get(),
+            String(NYM_ID).Get(),
             strIDAcct.Get());
     }
 
@@ -7686,6 +7695,10 @@ void Notary::NotarizeProcessNymbox(
     const Identifier NOTARY_ID(server_.m_strNotaryID), NYM_ID(theNym);
     std::set<TransactionNumber> newNumbers;
     Ledger theNymbox(NYM_ID, NYM_ID, NOTARY_ID);
+    // Receipts accepted by this request. They are removed, and the nymbox is
+    // signed and saved, once all the items have been processed.
+    std::set<TransactionNumber> nymboxReceiptsBeingAccepted;
+    std::vector<OTTransaction*> successNotices;
     String strNymID(NYM_ID);
     bool bSuccessLoadingNymbox = theNymbox.LoadNymbox();
 
@@ -7922,7 +7935,9 @@ void Notary::NotarizeProcessNymbox(
                     tranOut.AddItem(*pResponseItem);
                     OTTransaction* pServerTransaction = nullptr;
 
-                    if ((nullptr !=
+                    if ((0 == nymboxReceiptsBeingAccepted.count(
+                                  pItem->GetReferenceToNum())) &&
+                        (nullptr !=
                          (pServerTransaction = theNymbox.GetTransaction(
                               pItem->GetReferenceToNum()))) &&
                         ((OTTransaction::finalReceipt ==
@@ -7992,16 +8007,9 @@ void Notary::NotarizeProcessNymbox(
                             // ['message'] located in pServerTransaction.
                             // Now we have the user's item and the item he is
                             // trying to accept.
-                            pServerTransaction->DeleteBoxReceipt(
-                                theNymbox);  // faster.
-                            theNymbox.RemoveTransaction(
+                            nymboxReceiptsBeingAccepted.insert(
                                 pServerTransaction->GetTransactionNum());
 
-                            theNymbox.ReleaseSignatures();
-                            theNymbox.SignContract(server_.m_nymServer);
-                            theNymbox.SaveContract();
-                            theNymbox.SaveNymbox();
-
                             // Now we can set the response item as an
                             // acknowledgement instead of the default
                             // (rejection)
@@ -8027,16 +8035,9 @@ void Notary::NotarizeProcessNymbox(
                             // Now we have the user's item and the item he is
                             // trying to accept.
 
-                            pServerTransaction->DeleteBoxReceipt(
-                                theNymbox);  // faster.
-                            theNymbox.RemoveTransaction(
+                            nymboxReceiptsBeingAccepted.insert(
                                 pServerTransaction->GetTransactionNum());
 
-                            theNymbox.ReleaseSignatures();
-                            theNymbox.SignContract(server_.m_nymServer);
-                            theNymbox.SaveContract();
-                            theNymbox.SaveNymbox();
-
                             // Now we can set the response item as an
                             // acknowledgement instead of the default
                             // (rejection)
@@ -8132,7 +8133,7 @@ void Notary::NotarizeProcessNymbox(
                                                            // the nymbox. It
                                                            // takes ownership.
 
-                                    pSuccessNotice->SaveBoxReceipt(theNymbox);
+                                    successNotices.push_back(pSuccessNotice);
                                 }
                             }
                             // pItem contains the current user's attempt to
@@ -8144,16 +8145,9 @@ void Notary::NotarizeProcessNymbox(
                             // Here we remove the blank transaction that was
                             // just accepted.
                             //
-                            pServerTransaction->DeleteBoxReceipt(
-                                theNymbox);  // faster.
-                            theNymbox.RemoveTransaction(
+                            nymboxReceiptsBeingAccepted.insert(
                                 pServerTransaction->GetTransactionNum());
 
-                            theNymbox.ReleaseSignatures();
-                            theNymbox.SignContract(server_.m_nymServer);
-                            theNymbox.SaveContract();
-                            theNymbox.SaveNymbox(&NYMBOX_HASH);
-
                             bNymboxHashRegenerated = true;
 
                             // Now we can set the response item as an
@@ -8179,16 +8173,9 @@ void Notary::NotarizeProcessNymbox(
                             // Now we have the user's item and the item he is
                             // trying to accept.
 
-                            pServerTransaction->DeleteBoxReceipt(
-                                theNymbox);  // faster.
-                            theNymbox.RemoveTransaction(
+                            nymboxReceiptsBeingAccepted.insert(
                                 pServerTransaction->GetTransactionNum());
 
-                            theNymbox.ReleaseSignatures();
-                            theNymbox.SignContract(server_.m_nymServer);
-                            theNymbox.SaveContract();
-                            theNymbox.SaveNymbox(&NYMBOX_HASH);
-
                             bNymboxHashRegenerated = true;
 
                             // Now we can set the response item as an
@@ -8225,6 +8212,25 @@ void Notary::NotarizeProcessNymbox(
                         nStatus);
                 }
             }
+
+            if (false == nymboxReceiptsBeingAccepted.empty()) {
+                for (const auto& number : nymboxReceiptsBeingAccepted) {
+                    theNymbox.DeleteBoxReceipt(number);  // faster.
+                    theNymbox.RemoveTransaction(number);
+                }
+
+                // The success notices were added to the nymbox above. Their
+                // box receipts are written before the nymbox that lists them.
+                for (auto& pSuccessNotice : successNotices) {
+                    pSuccessNotice->SaveBoxReceipt(theNymbox);
+                }
+
+                theNymbox.ReleaseSignatures();
+                theNymbox.SignContract(server_.m_nymServer);
+                theNymbox.SaveContract();
+                theNymbox.SaveNymbox(
+                    bNymboxHashRegenerated ? &NYMBOX_HASH : nullptr);
+            }
         }
     }
 
@@ -8319,6 +8325,26 @@ void Notary::NotarizeProcessInbox(
     std::int64_t lTotalBeingAccepted{0};
     std::list<TransactionNumber> theListOfInboxReceiptsBeingRemoved{};
     bool bVerifiedBalanceStatement{false};
+    // The receipts being accepted are removed from theInbox, and the account
+    // and sender boxes are changed, in memory only. Nothing is written until
+    // every item in the request has been accepted, and then each file is
+    // signed and saved once.
+    Ledger theInbox(NYM_ID, ACCOUNT_ID, NOTARY_ID);
+    bool bLoadedInbox{false};
+    bool bAcceptedAllItems{true};
+    std::set<TransactionNumber> inboxReceiptsBeingAccepted{};
+    std::map<std::string, SenderBoxes> senderBoxes{};
+    std::vector<Item*> responseItems{};
+    // A receipt that an earlier item already accepted can't be accepted twice.
+    auto findInboxReceipt = [&](const TransactionNumber number) {
+        OTTransaction* output{nullptr};
+
+        if (0 == inboxReceiptsBeingAccepted.count(number)) {
+            output = theInbox.GetTransaction(number);
+        }
+
+        return output;
+    };
     const bool allowed =
         NYM_IS_ALLOWED(strNymID, ServerSettings::__transact_process_inbox);
 
@@ -8826,6 +8852,18 @@ void Notary::NotarizeProcessInbox(
     // THE ABOVE LOOP WAS JUST A TEST RUN (TO VERIFY BALANCE
     // AGREEMENT BEFORE WE BOTHERED TO RUN THIS LOOP BELOW...)
 
+    // Need to load the Inbox first, in order to look up the transactions
+    // that the client is accepting. This is possible because the client has
+    // included the transaction numbers. It's loaded once here, and every
+    // item below works on the same copy.
+    if (!theInbox.LoadInbox()) {
+        Log::Error("Error loading inbox during processInbox\n");
+    } else if (false == theInbox.VerifyAccount(server_.m_nymServer)) {
+        Log::Error("Error verifying inbox during processInbox\n");
+    } else {
+        bLoadedInbox = true;
+    }
+
     // loop through the items that make up the incoming transaction
     for (auto& pItem : processInbox.GetItemList()) {
         OT_ASSERT(nullptr != pItem);
@@ -8937,24 +8975,12 @@ void Notary::NotarizeProcessInbox(
                                                        // destructor will
         // cleanup the item. It
         // "owns" it now.
-
-        // Need to load the Inbox first, in order to look up the
-        // transaction that
-        // the client is accepting. This is possible because the
-        // client has included
-        // the transaction number.  I'll just look it up in his
-        // inbox and then
-        // process it.
-        // theAcctID is the ID on the client Account that was
-        // passed in.
-        Ledger theInbox(NYM_ID, ACCOUNT_ID, NOTARY_ID);
+        responseItems.push_back(pResponseItem);
 
         OTTransaction* pServerTransaction = nullptr;
 
-        if (!theInbox.LoadInbox()) {
-            Log::Error("Error loading inbox during processInbox\n");
-        } else if (false == theInbox.VerifyAccount(server_.m_nymServer)) {
-            Log::Error("Error verifying inbox during processInbox\n");
+        if (false == bLoadedInbox) {
+            Log::Error("Inbox unavailable during processInbox\n");
         }
         //
         // Warning! In the case of a
@@ -8972,7 +8998,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = findInboxReceipt(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::paymentReceipt == pServerTransaction->GetType()) ||
              (OTTransaction::marketReceipt == pServerTransaction->GetType()))) {
@@ -8982,17 +9008,8 @@ void Notary::NotarizeProcessInbox(
             // have the user's
             // item AND the receipt he is trying to accept.
 
-            pServerTransaction->DeleteBoxReceipt(theInbox);  // faster.
-            theInbox.RemoveTransaction(pServerTransaction->GetTransactionNum());
-
-            theInbox.ReleaseSignatures();
-            theInbox.SignContract(server_.m_nymServer);
-            theInbox.SaveContract();
-            theAccount.SaveInbox(theInbox);
-            theAccount.ReleaseSignatures();
-            theAccount.SignContract(server_.m_nymServer);
-            theAccount.SaveContract();
-            theAccount.SaveAccount();
+            inboxReceiptsBeingAccepted.insert(
+                pServerTransaction->GetTransactionNum());
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -9004,7 +9021,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = findInboxReceipt(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::finalReceipt == pServerTransaction->GetType()))) {
             // pItem contains the current user's attempt to
@@ -9013,17 +9030,8 @@ void Notary::NotarizeProcessInbox(
             // have the user's
             // item AND the receipt he is trying to accept.
 
-            pServerTransaction->DeleteBoxReceipt(theInbox);  // faster.
-            theInbox.RemoveTransaction(pServerTransaction->GetTransactionNum());
-
-            theInbox.ReleaseSignatures();
-            theInbox.SignContract(server_.m_nymServer);
-            theInbox.SaveContract();
-            theAccount.SaveInbox(theInbox);
-            theAccount.ReleaseSignatures();
-            theAccount.SignContract(server_.m_nymServer);
-            theAccount.SaveContract();
-            theAccount.SaveAccount();
+            inboxReceiptsBeingAccepted.insert(
+                pServerTransaction->GetTransactionNum());
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -9035,7 +9043,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = findInboxReceipt(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::basketReceipt == pServerTransaction->GetType()))) {
             // pItem contains the current user's attempt to
@@ -9044,17 +9052,8 @@ void Notary::NotarizeProcessInbox(
             // have the user's
             // item AND the receipt he is trying to accept.
 
-            pServerTransaction->DeleteBoxReceipt(theInbox);  // faster.
-            theInbox.RemoveTransaction(pServerTransaction->GetTransactionNum());
-
-            theInbox.ReleaseSignatures();
-            theInbox.SignContract(server_.m_nymServer);
-            theInbox.SaveContract();
-            theAccount.SaveInbox(theInbox);
-            theAccount.ReleaseSignatures();
-            theAccount.SignContract(server_.m_nymServer);
-            theAccount.SaveContract();
-            theAccount.SaveAccount();
+            inboxReceiptsBeingAccepted.insert(
+                pServerTransaction->GetTransactionNum());
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -9087,7 +9086,7 @@ void Notary::NotarizeProcessInbox(
                                     // checkReceipts. Because
                                     // they are
              ) &&
-            (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            (nullptr != (pServerTransaction = findInboxReceipt(
                              pItem->GetReferenceToNum()))) &&
             ((OTTransaction::pending ==
               pServerTransaction->GetType()) ||  // pending
@@ -9213,17 +9212,8 @@ void Notary::NotarizeProcessInbox(
                     // Now we have the user's item and the item
                     // he is trying to accept.
 
-                    pServerTransaction->DeleteBoxReceipt(theInbox);  // faster.
-                    theInbox.RemoveTransaction(
+                    inboxReceiptsBeingAccepted.insert(
                         pServerTransaction->GetTransactionNum());
-                    theInbox.ReleaseSignatures();
-                    theInbox.SignContract(server_.m_nymServer);
-                    theInbox.SaveContract();
-                    theAccount.SaveInbox(theInbox);
-                    theAccount.ReleaseSignatures();
-                    theAccount.SignContract(server_.m_nymServer);
-                    theAccount.SaveContract();
-                    theAccount.SaveAccount();
 
                     // Now we can set the response item as an
                     // acknowledgement instead of the default
@@ -9274,51 +9264,65 @@ void Notary::NotarizeProcessInbox(
                     // accepted.
                     // The 'from' inbox is loaded in order to
                     // put a notice of this acceptance for the
-                    // sender's records.
-                    Ledger theFromOutbox(
-                        IDFromAccount,
-                        NOTARY_ID),  // Sender's *OUTBOX*
-                        theFromInbox(
-                            IDFromAccount,
-                            NOTARY_ID);  // Sender's *INBOX*
-
-                    bool bSuccessLoadingInbox = theFromInbox.LoadInbox();
-                    bool bSuccessLoadingOutbox = theFromOutbox.LoadOutbox();
-
-                    // THE FROM INBOX -- We are adding an item
-                    // here (acceptance of transfer),
-                    // so we will create this inbox if we have
-                    // to, so we can add that record to it.
-
-                    if (true == bSuccessLoadingInbox)
-                        bSuccessLoadingInbox =
-                            theFromInbox.VerifyAccount(server_.m_nymServer);
-                    else
-                        Log::Error("ERROR missing 'from' "
-                                   "inbox in "
-                                   "Notary::"
-                                   "NotarizeProcessInbox.\n");
-                    // THE FROM OUTBOX -- We are removing an
-                    // item, so this outbox SHOULD already
-                    // exist.
-
-                    if (true == bSuccessLoadingOutbox)
-                        bSuccessLoadingOutbox =
-                            theFromOutbox.VerifyAccount(server_.m_nymServer);
-                    else  // If it does not already exist, that
-                        // is an error condition. For now, log
-                        // and fail.
-                        Log::Error("ERROR missing 'from' "
-                                   "outbox in "
-                                   "Notary::"
-                                   "NotarizeProcessInbox.\n");
-                    if (!bSuccessLoadingInbox ||
-                        false == bSuccessLoadingOutbox) {
-                        Log::Error("ERROR loading 'from' "
-                                   "inbox or outbox in "
-                                   "Notary::"
-                                   "NotarizeProcessInbox.\n");
-                    } else {
+                    // sender's records. Transfers from the same
+                    // account share one copy of each box.
+                    const std::string strFromAcctID(
+                        String(IDFromAccount).Get());
+                    auto sender = senderBoxes.find(strFromAcctID);
+
+                    if (senderBoxes.end() == sender) {
+                        std::unique_ptr<Ledger> pFromOutbox(new Ledger(
+                            IDFromAccount, NOTARY_ID));  // Sender's *OUTBOX*
+                        std::unique_ptr<Ledger> pFromInbox(new Ledger(
+                            IDFromAccount, NOTARY_ID));  // Sender's *INBOX*
+
+                        bool bSuccessLoadingInbox = pFromInbox->LoadInbox();
+                        bool bSuccessLoadingOutbox = pFromOutbox->LoadOutbox();
+
+                        // THE FROM INBOX -- We are adding an item
+                        // here (acceptance of transfer),
+                        // so we will create this inbox if we have
+                        // to, so we can add that record to it.
+
+                        if (true == bSuccessLoadingInbox)
+                            bSuccessLoadingInbox =
+                                pFromInbox->VerifyAccount(server_.m_nymServer);
+                        else
+                            Log::Error("ERROR missing 'from' "
+                                       "inbox in "
+                                       "Notary::"
+                                       "NotarizeProcessInbox.\n");
+                        // THE FROM OUTBOX -- We are removing an
+                        // item, so this outbox SHOULD already
+                        // exist.
+
+                        if (true == bSuccessLoadingOutbox)
+                            bSuccessLoadingOutbox = pFromOutbox->VerifyAccount(
+                                server_.m_nymServer);
+                        else  // If it does not already exist, that
+                            // is an error condition. For now, log
+                            // and fail.
+                            Log::Error("ERROR missing 'from' "
+                                       "outbox in "
+                                       "Notary::"
+                                       "NotarizeProcessInbox.\n");
+                        if (!bSuccessLoadingInbox ||
+                            false == bSuccessLoadingOutbox) {
+                            Log::Error("ERROR loading 'from' "
+                                       "inbox or outbox in "
+                                       "Notary::"
+                                       "NotarizeProcessInbox.\n");
+                        } else {
+                            sender =
+                                senderBoxes.emplace(strFromAcctID, SenderBoxes{})
+                                    .first;
+                            sender->second.inbox_ = std::move(pFromInbox);
+                            sender->second.outbox_ = std::move(pFromOutbox);
+                        }
+                    }
+
+                    if (senderBoxes.end() != sender) {
+                        auto& theFromInbox = *sender->second.inbox_;
                         // Generate a new transaction number for
                         // the sender's inbox (to notice him of
                         // acceptance.)
@@ -9430,56 +9434,11 @@ void Notary::NotarizeProcessInbox(
                             // makes them easy
                             // to remove as well.
 
-                            pServerTransaction->DeleteBoxReceipt(
-                                theFromOutbox);  // faster.
-                            theFromOutbox.RemoveTransaction(
+                            sender->second.removed_.insert(
                                 pServerTransaction->GetTransactionNum());
-
-                            pServerTransaction->DeleteBoxReceipt(
-                                theInbox);  // faster.
-                            theInbox.RemoveTransaction(
+                            inboxReceiptsBeingAccepted.insert(
                                 pServerTransaction->GetTransactionNum());
 
-                            // NOTICE BTW, warning: Notice that
-                            // the box receipts are marked for
-                            // deletion
-                            // the instant they are removed from
-                            // their respective boxes.
-                            // Meanwhile, the client
-                            // may not have actually DOWNLOADED
-                            // those box receipts. Once they are
-                            // ACTUALLY
-                            // deleted, then client will never
-                            // have the chance. It's assumed
-                            // that client doesn't
-                            // care, since the receipts are
-                            // already out of his box.
-
-                            theFromInbox.ReleaseSignatures();
-                            theFromOutbox.ReleaseSignatures();
-
-                            theFromInbox.SignContract(server_.m_nymServer);
-                            theFromOutbox.SignContract(server_.m_nymServer);
-
-                            theFromInbox.SaveContract();
-                            theFromOutbox.SaveContract();
-
-                            theFromInbox.SaveInbox();
-                            theFromOutbox.SaveOutbox();
-
-                            // Release any signatures that were
-                            // there before (Old ones won't
-                            // verify anymore anyway, since the
-                            // content has changed.)
-                            theInbox.ReleaseSignatures();
-                            theInbox.SignContract(server_.m_nymServer);
-                            theInbox.SaveContract();
-                            theAccount.SaveInbox(theInbox);
-                            theAccount.ReleaseSignatures();
-                            theAccount.SignContract(server_.m_nymServer);
-                            theAccount.SaveContract();
-                            theAccount.SaveAccount();
-
                             // Now we can set the response item
                             // as an acknowledgement instead of
                             // the default (rejection)
@@ -9511,9 +9470,10 @@ void Notary::NotarizeProcessInbox(
                             // real, requires saving the box
                             // receipt
                             // as well. (Which is stored in a
-                            // separate file.)
+                            // separate file.) That happens when
+                            // the sender's boxes are saved.
                             //
-                            pInboxTransaction->SaveBoxReceipt(theFromInbox);
+                            sender->second.added_.push_back(pInboxTransaction);
                         } else {
                             delete pInboxTransaction;
                             pInboxTransaction = nullptr;
@@ -9536,16 +9496,74 @@ void Notary::NotarizeProcessInbox(
                 pItem->GetReferenceToNum());
         }
 
-        // sign the response item before sending it back (it's
-        // already been added to the transaction above)
-        // Now, whether it was rejection or acknowledgement, it
-        // is set properly and it is signed, and it
-        // is owned by the transaction, who will take it from
-        // here.
-        pResponseItem->SignContract(server_.m_nymServer);
-        pResponseItem->SaveContract();
+        if (Item::acknowledgement != pResponseItem->GetStatus()) {
+            bAcceptedAllItems = false;
+        }
     }  // for LOOP (each item)
 
+    // The balance agreement covers every receipt in the request, so either
+    // all of them are accepted or none are.
+    if (bAcceptedAllItems && (false == inboxReceiptsBeingAccepted.empty())) {
+        for (auto& it : senderBoxes) {
+            auto& theFromInbox = *it.second.inbox_;
+            auto& theFromOutbox = *it.second.outbox_;
+
+            for (const auto& number : it.second.removed_) {
+                theFromOutbox.DeleteBoxReceipt(number);  // faster.
+                theFromOutbox.RemoveTransaction(number);
+            }
+
+            theFromInbox.ReleaseSignatures();
+            theFromOutbox.ReleaseSignatures();
+            theFromInbox.SignContract(server_.m_nymServer);
+            theFromOutbox.SignContract(server_.m_nymServer);
+            theFromInbox.SaveContract();
+            theFromOutbox.SaveContract();
+            theFromInbox.SaveInbox();
+            theFromOutbox.SaveOutbox();
+
+            for (auto& pInboxTransaction : it.second.added_) {
+                pInboxTransaction->SaveBoxReceipt(theFromInbox);
+            }
+        }
+
+        // NOTICE BTW, warning: the box receipts are marked for deletion the
+        // instant they are removed from their respective boxes. Meanwhile,
+        // the client may not have actually DOWNLOADED those box receipts.
+        // It's assumed that client doesn't care, since the receipts are
+        // already out of his box.
+        for (const auto& number : inboxReceiptsBeingAccepted) {
+            theInbox.DeleteBoxReceipt(number);  // faster.
+            theInbox.RemoveTransaction(number);
+        }
+
+        // Release any signatures that were there before (Old ones won't
+        // verify anymore anyway, since the content has changed.)
+        theInbox.ReleaseSignatures();
+        theInbox.SignContract(server_.m_nymServer);
+        theInbox.SaveContract();
+        theAccount.SaveInbox(theInbox);
+        theAccount.ReleaseSignatures();
+        theAccount.SignContract(server_.m_nymServer);
+        theAccount.SaveContract();
+        theAccount.SaveAccount();
+    } else if (false == bAcceptedAllItems) {
+        // Nothing was saved, so none of the items may claim otherwise.
+        for (auto& pResponse : responseItems) {
+            pResponse->SetStatus(Item::rejection);
+        }
+    }
+
+    // sign the response items before sending them back (they've
+    // already been added to the transaction above)
+    // Now, whether rejection or acknowledgement, each one is
+    // set properly and signed, and owned by the transaction,
+    // who will take it from here.
+    for (auto& pResponse : responseItems) {
+        pResponse->SignContract(server_.m_nymServer);
+        pResponse->SaveContract();
+    }
+
 send_message:
     // I put this here so it's signed/saved whether the balance agreement itself
     // was successful OR NOT. (Or whether it even existed or not.)
@@ -65,10 +65,15 @@ ReplyMessage::ReplyMessage(
     : wallet_(wallet)
     , signer_(signer)
     , original_(input)
+    , type_(type)
     , notary_id_(notaryID)
+    , nym_id_(input.m_strNymID)
+    , purported_notary_id_(input.m_strNotaryID)
+    , account_id_(input.m_strAcctID)
+    , unit_id_(input.m_strInstrumentDefinitionID)
     , message_(output)
     , server_(server)
-    , nymfile_(input.m_strNymID)
+    , nymfile_(nym_id_)
     , init_(false)
     , drop_(false)
     , drop_status_(false)
@@ -92,12 +97,11 @@ std::set<RequestNumber> ReplyMessage::Acknowledged() const
     return output;
 }
 
+const Identifier& ReplyMessage::AccountID() const { return account_id_; }
+
 void ReplyMessage::attach_request()
 {
-    const std::string command = original_.m_strCommand.Get();
-    const auto type = Message::Type(command);
-
-    switch (type) {
+    switch (type_) {
         case MessageType::getMarketOffers:
         case MessageType::getMarketRecentTrades:
         case MessageType::getNymMarketOffers:
@@ -123,7 +127,7 @@ void ReplyMessage::attach_request()
         case MessageType::requestAdmin:
         case MessageType::addClaim: {
             otInfo << OT_METHOD << __FUNCTION__ << ": Attaching original "
-                   << command << " message." << std::endl;
+                   << original_.m_strCommand << " message." << std::endl;
             message_.m_ascInReferenceTo.SetString(String(original_));
         } break;
         case MessageType::pingNotary:
@@ -139,17 +143,14 @@ void ReplyMessage::attach_request()
 
 void ReplyMessage::clear_request()
 {
-    const std::string command = original_.m_strCommand.Get();
-    const auto type = Message::Type(command);
-
-    switch (type) {
+    switch (type_) {
         case MessageType::checkNym:
         case MessageType::getNymbox:
         case MessageType::getAccountData:
         case MessageType::getInstrumentDefinition:
         case MessageType::getMint: {
             otInfo << OT_METHOD << __FUNCTION__ << ": Clearing original "
-                   << command << " message." << std::endl;
+                   << original_.m_strCommand << " message." << std::endl;
             message_.m_ascInReferenceTo.Release();
         } break;
         case MessageType::getMarketOffers:
@@ -206,19 +207,15 @@ bool ReplyMessage::HaveContext() const { return bool(context_); }
 
 bool ReplyMessage::init()
 {
-    const Identifier senderNymID = Identifier(original_.m_strNymID);
-    const Identifier purportedServerID = Identifier(original_.m_strNotaryID);
-
-    bool out = UserCommandProcessor::check_server_lock(senderNymID);
+    bool out = UserCommandProcessor::check_server_lock(nym_id_);
 
     if (out) {
         out &= UserCommandProcessor::check_message_notary(
-            purportedServerID, notary_id_);
+            purported_notary_id_, notary_id_);
     }
 
     if (out) {
-        out &= UserCommandProcessor::check_client_isnt_server(
-            senderNymID, signer_);
+        out &= UserCommandProcessor::check_client_isnt_server(nym_id_, signer_);
     }
 
     return out;
@@ -228,14 +225,19 @@ const bool& ReplyMessage::Init() const { return init_; }
 
 bool ReplyMessage::init_nym()
 {
-    sender_nym_ = wallet_.Nym(Identifier(original_.m_strNymID));
+    sender_nym_ = wallet_.Nym(nym_id_);
 
     return bool(sender_nym_);
 }
 
+const Identifier& ReplyMessage::InstrumentDefinitionID() const
+{
+    return unit_id_;
+}
+
 bool ReplyMessage::InitNymfileCredentials()
 {
-    if (false == bool(sender_nym_)) {
+    if ((false == bool(sender_nym_)) && (false == init_nym())) {
 
         return false;
     }
@@ -265,6 +267,8 @@ bool ReplyMessage::LoadNym()
     return bool(sender_nym_);
 }
 
+const Identifier& ReplyMessage::NymID() const { return nym_id_; }
+
 const Message& ReplyMessage::Original() const { return original_; }
 
 Nym& ReplyMessage::Nymfile() { return nymfile_; }
@@ -339,6 +343,17 @@ void ReplyMessage::SetRequestNumber(const RequestNumber number)
     message_.m_lNewRequestNum = number;
 }
 
+void ReplyMessage::SetSession(const String& id, const OTPassword& key)
+{
+    session_id_ = id;
+    session_key_.reset(new OTPassword(key));
+}
+
+void ReplyMessage::SetSessionKey(const Data& publicKey)
+{
+    message_.m_ascSessionKey.SetData(publicKey, false);
+}
+
 void ReplyMessage::SetSuccess(const bool success)
 {
     message_.m_bSuccess = success;
@@ -362,7 +377,14 @@ void ReplyMessage::SetTargetNym(const String& nymID)
 
 ReplyMessage::~ReplyMessage()
 {
-    message_.SignContract(signer_);
+    // Replies which are dropped into the nymbox outlive the session, so they
+    // are always signed.
+    if (session_key_ && (false == drop_)) {
+        message_.SignSession(session_id_, *session_key_);
+    } else {
+        message_.SignContract(signer_);
+    }
+
     message_.SaveContract();
 
     if (drop_ && context_) {
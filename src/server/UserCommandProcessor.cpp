@@ -41,6 +41,7 @@
 #include "opentxs/server/UserCommandProcessor.hpp"
 
 #include "opentxs/api/client/Wallet.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/Identity.hpp"
 #include "opentxs/api/Native.hpp"
 #include "opentxs/api/Server.hpp"
@@ -51,6 +52,7 @@
 #include "opentxs/core/contract/basket/BasketContract.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/cron/OTCronItem.hpp"
+#include "opentxs/core/crypto/Libsodium.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/crypto/OTAsymmetricKey.hpp"
 #include "opentxs/core/script/OTParty.hpp"
@@ -78,9 +80,11 @@
 #include "opentxs/server/ReplyMessage.hpp"
 #include "opentxs/server/ServerSettings.hpp"
 #include "opentxs/server/Transactor.hpp"
+#include "opentxs/OT.hpp"
 
 #include <inttypes.h>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -90,6 +94,7 @@
 #define NYMBOX_DEPTH 0
 #define INBOX_DEPTH 1
 #define OUTBOX_DEPTH 2
+#define MAX_SESSIONS_PER_NYM 8
 
 namespace opentxs::server
 {
@@ -293,7 +298,7 @@ bool UserCommandProcessor::add_numbers_to_nymbox(
 void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
 {
     auto& context = reply.Context();
-    const Identifier NOTARY_ID(server_.m_strNotaryID);
+    const auto& NOTARY_ID = server_.GetServerID();
 
     // The server reads the list of acknowledged replies from the incoming
     // client message... If we add any acknowledged replies to the server-side
@@ -382,7 +387,8 @@ bool UserCommandProcessor::check_client_nym(ReplyMessage& reply) const
     const auto& msgIn = reply.Original();
     auto& nymfile = reply.Nymfile();
 
-    if (false == nymfile.LoadPublicKey()) {
+    if ((false == reply.InitNymfileCredentials()) ||
+        (0 == nymfile.GetMasterCredentialCount())) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Failure loading public credentials for Nym: "
               << String(nymfile.ID()) << std::endl;
@@ -398,24 +404,30 @@ bool UserCommandProcessor::check_client_nym(ReplyMessage& reply) const
         return false;
     }
 
-    if (false == nymfile.VerifyPseudonym()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to verify nym "
-              << String(nymfile.ID()) << std::endl;
+    otWarn << OT_METHOD << __FUNCTION__ << "Nym verified!" << std::endl;
 
-        return false;
-    }
+    if (msgIn.m_strSessionID.Exists()) {
+        if (false == verify_session(reply)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Unable to verify message session MAC." << std::endl;
 
-    otWarn << OT_METHOD << __FUNCTION__ << "Nym verified!" << std::endl;
+            return false;
+        }
+    } else {
+        if (false == msgIn.VerifySignature(nymfile)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Unable to verify message signature." << std::endl;
 
-    if (false == msgIn.VerifySignature(nymfile)) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Unable to verify message signature." << std::endl;
+            return false;
+        }
 
-        return false;
+        if (msgIn.m_ascSessionKey.Exists()) {
+            open_session(reply);
+        }
     }
 
     otInfo << OT_METHOD << __FUNCTION__
-           << ": Message signature verification successful." << std::endl;
+           << ": Message authentication successful." << std::endl;
 
     if (!nymfile.LoadSignedNymfile(server_.m_nymServer)) {
         otErr << OT_METHOD << __FUNCTION__
@@ -614,7 +626,7 @@ bool UserCommandProcessor::cmd_delete_asset_account(ReplyMessage& reply) const
 
     OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_del_asset_acct);
 
-    const Identifier accountID(msgIn.m_strAcctID);
+    const auto& accountID = reply.AccountID();
     const auto& context = reply.Context();
     const auto& serverID = context.Server();
     const auto& serverNym = *context.Nym();
@@ -831,7 +843,7 @@ bool UserCommandProcessor::cmd_get_account_data(ReplyMessage& reply) const
     const auto& nymID = context.RemoteNym().ID();
     const auto& serverID = context.Server();
     const auto& serverNym = *context.Nym();
-    const Identifier accountID(msgIn.m_strAcctID);
+    const auto& accountID = reply.AccountID();
     const auto account = Account::LoadExistingAccount(accountID, serverID);
 
     if (nullptr == account) {
@@ -918,7 +930,7 @@ bool UserCommandProcessor::cmd_get_box_receipt(ReplyMessage& reply) const
     const auto& nymID = context.RemoteNym().ID();
     const auto& serverID = context.Server();
     const auto& serverNym = *context.Nym();
-    const Identifier accountID(msgIn.m_strAcctID);
+    const auto& accountID = reply.AccountID();
     std::unique_ptr<Ledger> box{};
 
     switch (boxType) {
@@ -986,7 +998,7 @@ bool UserCommandProcessor::cmd_get_instrument_definition(
 
     OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_contract);
 
-    const Identifier contractID(msgIn.m_strInstrumentDefinitionID);
+    const auto& contractID = reply.InstrumentDefinitionID();
 
     auto serialized = Data::Factory();
     auto unitDefiniton = wallet_.UnitDefinition(contractID);
@@ -1202,10 +1214,10 @@ bool UserCommandProcessor::cmd_get_request_number(ReplyMessage& reply) const
     }
 
     reply.SetRequestNumber(number);
-    const Identifier NOTARY_ID(server_.m_strNotaryID);
+    const auto& NOTARY_ID = server_.GetServerID();
     Identifier EXISTING_NYMBOX_HASH = context.LocalNymboxHash();
 
-    if (String(EXISTING_NYMBOX_HASH).Exists()) {
+    if (false == EXISTING_NYMBOX_HASH.empty()) {
         reply.SetNymboxHash(EXISTING_NYMBOX_HASH);
     } else {
         const auto& nymID = context.RemoteNym().ID();
@@ -1498,7 +1510,7 @@ bool UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
     const auto& serverNym = *context.Nym();
     const auto& serverNymID = serverNym.ID();
     auto& nymfile = reply.Nymfile();
-    const Identifier accountID(msgIn.m_strAcctID);
+    const auto& accountID = reply.AccountID();
     Identifier nymboxHash{};
     std::unique_ptr<Ledger> input(new Ledger(nymID, accountID, serverID));
     std::unique_ptr<Ledger> responseLedger(Ledger::GenerateLedger(
@@ -1605,7 +1617,7 @@ bool UserCommandProcessor::cmd_process_inbox(ReplyMessage& reply) const
     const auto& serverNym = *context.Nym();
     const auto& serverNymID = serverNym.ID();
     auto& nymfile = reply.Nymfile();
-    const Identifier accountID(msgIn.m_strAcctID);
+    const auto& accountID = reply.AccountID();
     Identifier nymboxHash{};
     std::unique_ptr<Ledger> input(new Ledger(nymID, accountID, serverID));
     std::unique_ptr<Ledger> responseLedger(Ledger::GenerateLedger(
@@ -1891,7 +1903,7 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
     const auto& nymID = context.RemoteNym().ID();
     const auto& serverID = context.Server();
     const auto& serverNym = *context.Nym();
-    const Identifier contractID(msgIn.m_strInstrumentDefinitionID);
+    const auto& contractID = reply.InstrumentDefinitionID();
 
     std::unique_ptr<Account> account(Account::GenerateNewAccount(
         nymID, serverID, serverNym, nymID, contractID));
@@ -2049,7 +2061,7 @@ bool UserCommandProcessor::cmd_register_instrument_definition(
 {
     const auto& msgIn = reply.Original();
     reply.SetInstrumentDefinitionID(msgIn.m_strInstrumentDefinitionID);
-    const Identifier contractID(msgIn.m_strInstrumentDefinitionID);
+    const auto& contractID = reply.InstrumentDefinitionID();
 
     OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_issue_asset);
 
@@ -2982,6 +2994,93 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_outbox(
     return outbox;
 }
 
+// Answers the handshake offered in a signed request. The reply carries the
+// server's ephemeral public key and is signed as well. A client which repeats
+// its offer gets the existing session back instead of a new one. Each nym may
+// hold up to MAX_SESSIONS_PER_NYM sessions (one per device), after which the
+// oldest is dropped.
+void UserCommandProcessor::open_session(ReplyMessage& reply) const
+{
+    const auto& msgIn = reply.Original();
+    const std::string nymID = String(reply.NymID()).Get();
+    auto clientKey = Data::Factory();
+
+    if (false == msgIn.m_ascSessionKey.GetData(clientKey, false)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid session key."
+              << std::endl;
+
+        return;
+    }
+
+    Lock lock(session_lock_);
+    const auto first = sessions_.lower_bound({nymID, ""});
+    auto oldest = sessions_.end();
+    std::size_t count{0};
+
+    for (auto it = first; (sessions_.end() != it) && (nymID == it->first.first);
+         ++it) {
+        const auto& session = it->second;
+
+        OT_ASSERT(session);
+
+        if (session->client_key_ == clientKey) {
+            reply.SetSessionKey(session->server_key_.get());
+
+            return;
+        }
+
+        if ((sessions_.end() == oldest) ||
+            (session->opened_ < oldest->second->opened_)) {
+            oldest = it;
+        }
+
+        ++count;
+    }
+
+    const auto& engine =
+        static_cast<const Libsodium&>(OT::App().Crypto().ED25519());
+    auto output = std::make_shared<Session>();
+    OTPassword privateKey;
+
+    OT_ASSERT(output);
+
+    if (false == engine.RandomKeypair(privateKey, output->server_key_)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to generate session key." << std::endl;
+
+        return;
+    }
+
+    output->client_key_ = clientKey;
+
+    if (false == Message::DeriveSessionKey(
+                     privateKey,
+                     clientKey,
+                     clientKey,
+                     output->server_key_,
+                     output->request_key_,
+                     output->reply_key_,
+                     output->id_)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to derive session key." << std::endl;
+
+        return;
+    }
+
+    output->opened_ = std::time(nullptr);
+
+    if (MAX_SESSIONS_PER_NYM <= count) {
+        OT_ASSERT(sessions_.end() != oldest);
+
+        sessions_.erase(oldest);
+    }
+
+    sessions_[{nymID, output->id_.Get()}] = output;
+    reply.SetSessionKey(output->server_key_.get());
+    otInfo << OT_METHOD << __FUNCTION__ << ": Opened session " << output->id_
+           << " for nym " << nymID << std::endl;
+}
+
 bool UserCommandProcessor::ProcessUserCommand(
     const Message& msgIn,
     Message& msgOut)
@@ -3308,6 +3407,51 @@ bool UserCommandProcessor::verify_box(
     return true;
 }
 
+// Only requests which never carry a transaction or a balance agreement may be
+// authenticated by a session MAC. The reply is MACed with the same session,
+// using its server to client key.
+bool UserCommandProcessor::verify_session(ReplyMessage& reply) const
+{
+    const auto& msgIn = reply.Original();
+    const auto type = Message::Type(msgIn.m_strCommand.Get());
+
+    if (false == Message::SessionEligible(type)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": " << msgIn.m_strCommand
+              << " requests must be signed." << std::endl;
+
+        return false;
+    }
+
+    std::shared_ptr<const Session> session{};
+
+    {
+        Lock lock(session_lock_);
+        auto it = sessions_.find(
+            {String(reply.NymID()).Get(), msgIn.m_strSessionID.Get()});
+
+        if (sessions_.end() != it) {
+            session = it->second;
+        }
+    }
+
+    if (false == bool(session)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": No session "
+              << msgIn.m_strSessionID << " for nym " << String(reply.NymID())
+              << std::endl;
+
+        return false;
+    }
+
+    if (false == msgIn.VerifySession(session->id_, session->request_key_)) {
+
+        return false;
+    }
+
+    reply.SetSession(session->id_, session->reply_key_);
+
+    return true;
+}
+
 bool UserCommandProcessor::verify_transaction(
     const OTTransaction* transaction,
     const Nym& signer) const
@@ -471,6 +471,6 @@ bool Contacts::Store(const proto::Contact& data, const std::string& alias)
     extract_addresses(lock, data);
     extract_nyms(lock, data);
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace opentxs::storage
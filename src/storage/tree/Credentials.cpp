@@ -223,7 +223,7 @@ bool Credentials::Store(const proto::Credential& cred, const std::string& alias)
         std::get<1>(metadata) = alias;
     }
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace storage
 }  // namespace opentxs
@@ -79,10 +79,7 @@ void Mailbox::init(const std::string& hash)
         version_ = 2;
     }
 
-    for (const auto& it : serialized->nym()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_list(*serialized);
 }
 
 bool Mailbox::Load(
@@ -101,35 +98,7 @@ bool Mailbox::save(const std::unique_lock<std::mutex>& lock) const
         abort();
     }
 
-    auto serialized = serialize();
-
-    if (!proto::Validate(serialized, VERBOSE)) {
-        return false;
-    }
-
-    return driver_.StoreProto(serialized, root_);
-}
-
-proto::StorageNymList Mailbox::serialize() const
-{
-    proto::StorageNymList serialized;
-    serialized.set_version(version_);
-
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(
-                item.first,
-                item.second,
-                *serialized.add_nym(),
-                proto::STORAGEHASH_RAW);
-        }
-    }
-
-    return serialized;
+    return save_list(lock, proto::STORAGEHASH_RAW);
 }
 
 bool Mailbox::Store(
@@ -43,18 +43,29 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/storage/Plugin.hpp"
 
+#include <map>
+
 #define OT_METHOD "opentxs::storage::Node::"
 
 namespace opentxs::storage
 {
 const std::string Node::BLANK_HASH = "blankblankblankblankblank";
+const std::size_t Node::CHUNK_ITEMS{256};
+const std::string Node::CHUNK_ID = "chunkchunkchunkchunkchunk";
+thread_local std::size_t Node::batch_{0};
+thread_local std::vector<Node::DeferredUpdate> Node::deferred_{};
 
 Node::Node(const opentxs::api::storage::Driver& storage, const std::string& key)
-    : driver_(storage)
+    : alive_(std::make_shared<const bool>(true))
+    , driver_(storage)
     , root_(key)
 {
 }
 
+bool Node::Batching() { return 0 < batch_; }
+
+void Node::BeginBatch() { ++batch_; }
+
 bool Node::check_hash(const std::string& hash) const
 {
     const bool empty = hash.empty();
@@ -63,6 +74,95 @@ bool Node::check_hash(const std::string& hash) const
     return !(empty || blank);
 }
 
+std::string Node::chunk_key(const std::string& id)
+{
+    // FNV-1a, so that an item is placed in the same chunk on every platform
+    std::uint64_t hash{14695981039346656037ULL};
+
+    for (const auto& c : id) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    static const char hex[] = "0123456789abcdef";
+    std::string output(16, '0');
+
+    for (auto i = output.rbegin(); i != output.rend(); ++i) {
+        *i = hex[hash & 0xf];
+        hash >>= 4;
+    }
+
+    return output;
+}
+
+bool Node::commit(const std::unique_lock<std::mutex>& lock) const
+{
+    const bool deferred = defer(nullptr, [this]() -> bool {
+        Lock nodeLock(write_lock_);
+
+        return save(nodeLock);
+    });
+
+    if (deferred) return true;
+
+    return save(lock);
+}
+
+bool Node::CommitBatch()
+{
+    if (0 == batch_) {
+        otErr << OT_METHOD << __FUNCTION__ << ": No batch in progress."
+              << std::endl;
+
+        return false;
+    }
+
+    if (0 < --batch_) return true;
+
+    std::vector<DeferredUpdate> updates{};
+    updates.swap(deferred_);
+    // Every child update is followed by an update of its parent, so running
+    // only the last update for each key still writes children before the
+    // parents which record their hashes.
+    std::map<DeferredKey, std::size_t> last{};
+
+    for (std::size_t i = 0; i < updates.size(); ++i) {
+        last[updates[i].key_] = i;
+    }
+
+    bool output{true};
+
+    for (std::size_t i = 0; i < updates.size(); ++i) {
+        const auto& update = updates[i];
+
+        const bool hasChild = (nullptr != update.key_.second);
+
+        if (last[update.key_] != i) continue;
+        if (update.node_.expired()) continue;
+        if (hasChild && update.child_.expired()) continue;
+
+        output &= update.update_();
+    }
+
+    return output;
+}
+
+bool Node::defer(const Node* child, std::function<bool()> update) const
+{
+    if (0 == batch_) return false;
+
+    DeferredUpdate deferred{};
+    deferred.key_ = {this, child};
+    deferred.node_ = alive_;
+
+    if (nullptr != child) deferred.child_ = child->alive_;
+
+    deferred.update_ = std::move(update);
+    deferred_.emplace_back(std::move(deferred));
+
+    return true;
+}
+
 bool Node::delete_item(const std::string& id)
 {
     std::unique_lock<std::mutex> lock(write_lock_);
@@ -73,7 +173,9 @@ bool Node::delete_item(const std::string& id)
         return false;
     }
 
-    return save(lock);
+    touch(id);
+
+    return commit(lock);
 }
 
 std::uint64_t Node::extract_revision(const proto::Contact& input) const
@@ -91,6 +193,17 @@ std::uint64_t Node::extract_revision(const proto::Seed& input) const
     return input.index();
 }
 
+void Node::forget_chunks(const std::string& prefix) const
+{
+    auto it = chunks_.lower_bound(prefix);
+
+    while (chunks_.end() != it) {
+        if (0 != it->first.compare(0, prefix.size(), prefix)) break;
+
+        it = chunks_.erase(it);
+    }
+}
+
 std::string Node::get_alias(const std::string& id) const
 {
     std::string output;
@@ -104,6 +217,15 @@ std::string Node::get_alias(const std::string& id) const
     return output;
 }
 
+bool Node::is_dirty(const std::string& prefix) const
+{
+    const auto it = dirty_.lower_bound(prefix);
+
+    if (dirty_.end() == it) return false;
+
+    return (0 == it->compare(0, prefix.size(), prefix));
+}
+
 ObjectList Node::List() const
 {
     ObjectList output;
@@ -118,6 +240,31 @@ ObjectList Node::List() const
     return output;
 }
 
+void Node::load_list(const proto::StorageNymList& serialized) const
+{
+    for (const auto& it : serialized.nym()) {
+        const auto& id = it.itemid();
+
+        if (0 != id.compare(0, CHUNK_ID.size(), CHUNK_ID)) {
+            item_map_.emplace(id, Metadata{it.hash(), it.alias(), 0, false});
+
+            continue;
+        }
+
+        std::shared_ptr<proto::StorageNymList> chunk;
+
+        if (false == driver_.LoadProto(it.hash(), chunk)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to load chunk "
+                  << id << std::endl;
+
+            abort();
+        }
+
+        chunks_[id.substr(CHUNK_ID.size())] = it.hash();
+        load_list(*chunk);
+    }
+}
+
 bool Node::load_raw(
     const std::string& id,
     std::string& output,
@@ -170,6 +317,7 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
 
     bool output{true};
     output &= migrate(root_, to);
+    output &= migrate_chunks(to);
 
     for (const auto& item : item_map_) {
         const auto& hash = std::get<0>(item.second);
@@ -179,6 +327,17 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
     return output;
 }
 
+bool Node::migrate_chunks(const opentxs::api::storage::Driver& to) const
+{
+    bool output{true};
+
+    for (const auto& chunk : chunks_) {
+        output &= migrate(chunk.second, to);
+    }
+
+    return output;
+}
+
 std::string Node::normalize_hash(const std::string& hash)
 {
     if (hash.empty()) {
@@ -212,6 +371,149 @@ std::string Node::Root() const
     return root_;
 }
 
+std::string Node::save_chunk(
+    const std::string& prefix,
+    const proto::StorageHashType type,
+    bool& success) const
+{
+    const bool top = prefix.empty();
+
+    if ((false == top) && (false == is_dirty(prefix))) {
+        const auto it = chunks_.find(prefix);
+
+        if (chunks_.end() != it) return it->second;
+    }
+
+    // Chunk keys only contain hex digits, so incrementing the last digit of
+    // the prefix gives the first key past this chunk
+    const auto begin = chunk_index_.lower_bound({prefix, ""});
+    auto end = chunk_index_.end();
+
+    if (false == top) {
+        auto limit = prefix;
+        ++limit.back();
+        end = chunk_index_.lower_bound({limit, ""});
+    }
+
+    std::size_t count{0};
+
+    for (auto it = begin; (end != it) && (CHUNK_ITEMS >= count); ++it) {
+        ++count;
+    }
+
+    const bool leaf = (CHUNK_ITEMS >= count) ||
+                      (prefix.size() >= begin->first.size());
+
+    if (leaf) forget_chunks(prefix);
+
+    if (begin == end) return {};
+
+    proto::StorageNymList serialized;
+    serialized.set_version(version_);
+
+    if (leaf) {
+        for (auto it = begin; it != end; ++it) {
+            const auto item = item_map_.find(it->second);
+
+            OT_ASSERT(item_map_.end() != item);
+
+            const bool goodID = !item->first.empty();
+            const bool goodHash = check_hash(std::get<0>(item->second));
+
+            if (goodID && goodHash) {
+                serialize_index(
+                    item->first, item->second, *serialized.add_nym(), type);
+            }
+        }
+    } else {
+        for (const auto& nibble : std::string("0123456789abcdef")) {
+            const auto child = prefix + nibble;
+            const auto hash = save_chunk(child, type, success);
+
+            if (false == hash.empty()) {
+                set_hash(
+                    version_,
+                    CHUNK_ID + child,
+                    hash,
+                    *serialized.add_nym(),
+                    proto::STORAGEHASH_PROTO);
+            }
+        }
+    }
+
+    std::string hash{};
+
+    if (false == proto::Validate(serialized, VERBOSE)) {
+        success = false;
+
+        return {};
+    }
+
+    if (false == driver_.StoreProto(serialized, hash)) {
+        success = false;
+
+        return {};
+    }
+
+    chunks_[prefix] = hash;
+
+    return hash;
+}
+
+bool Node::save_list(
+    const std::unique_lock<std::mutex>& lock,
+    const proto::StorageHashType type) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (CHUNK_ITEMS >= item_map_.size()) {
+        proto::StorageNymList serialized;
+        serialized.set_version(version_);
+
+        for (const auto& item : item_map_) {
+            const bool goodID = !item.first.empty();
+            const bool goodHash = check_hash(std::get<0>(item.second));
+
+            if (goodID && goodHash) {
+                serialize_index(
+                    item.first, item.second, *serialized.add_nym(), type);
+            }
+        }
+
+        if (false == proto::Validate(serialized, VERBOSE)) return false;
+
+        chunks_.clear();
+        dirty_.clear();
+        chunk_index_.clear();
+        indexed_ = false;
+
+        return driver_.StoreProto(serialized, root_);
+    }
+
+    // The whole list is only hashed the first time it is written as chunks
+    // after being loaded or growing past the threshold
+    if (false == indexed_) {
+        chunk_index_.clear();
+
+        for (const auto& it : item_map_) {
+            chunk_index_.emplace(chunk_key(it.first), it.first);
+        }
+
+        indexed_ = true;
+    }
+
+    // Only the chunks on the path to a changed item are written again
+    bool success{true};
+    const auto hash = save_chunk("", type, success);
+
+    if (false == success) return false;
+
+    root_ = hash;
+    dirty_.clear();
+
+    return true;
+}
+
 void Node::serialize_index(
     const std::string& id,
     const Metadata& metadata,
@@ -234,8 +536,9 @@ bool Node::set_alias(const std::string& id, const std::string& alias)
     }
 
     std::get<1>(item_map_[id]) = alias;
+    touch(id);
 
-    return save(lock);
+    return commit(lock);
 }
 
 void Node::set_hash(
@@ -275,6 +578,7 @@ bool Node::store_raw(
 
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    touch(id);
 
     if (!driver_.Store(true, data, hash)) {
         return false;
@@ -284,7 +588,24 @@ bool Node::store_raw(
         std::get<1>(metadata) = alias;
     }
 
-    return save(lock);
+    return commit(lock);
+}
+
+void Node::touch(const std::string& id) const
+{
+    if (chunks_.empty()) return;
+
+    auto key = chunk_key(id);
+
+    if (indexed_) {
+        if (item_map_.end() == item_map_.find(id)) {
+            chunk_index_.erase({key, id});
+        } else {
+            chunk_index_.emplace(key, id);
+        }
+    }
+
+    dirty_.emplace(std::move(key));
 }
 
 std::uint32_t Node::UpgradeLevel() const { return original_version_; }
@@ -670,6 +670,8 @@ void Nym::save(PeerReplies* input, const Lock& lock, StorageBox type)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input, type)) return;
+
     update_hash(type, input->Root());
 
     if (!save(lock)) {
@@ -690,6 +692,8 @@ void Nym::save(PeerRequests* input, const Lock& lock, StorageBox type)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input, type)) return;
+
     update_hash(type, input->Root());
 
     if (!save(lock)) {
@@ -710,6 +714,8 @@ void Nym::save(Mailbox* input, const Lock& lock, StorageBox type)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input, type)) return;
+
     update_hash(type, input->Root());
 
     if (!save(lock)) {
@@ -730,6 +736,8 @@ void Nym::save(class Threads* input, const Lock& lock)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input)) return;
+
     if (mail_inbox_) {
         update_hash(StorageBox::MAILINBOX, mail_inbox_->Root());
     }
@@ -758,6 +766,8 @@ void Nym::save(class Contexts* input, const Lock& lock)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input)) return;
+
     contexts_root_ = input->Root();
 
     if (!save(lock)) {
@@ -778,6 +788,8 @@ void Nym::save(class Issuers* input, const Lock& lock)
         OT_FAIL;
     }
 
+    if (defer_save(*this, input)) return;
+
     issuers_root_ = input->Root();
 
     if (!save(lock)) {
@@ -1080,7 +1092,7 @@ bool Nym::Store(
     checked_.store(true);
     private_.store(!incomingPublic);
 
-    return save(lock);
+    return commit(lock);
 }
 
 Nym::~Nym() {}
@@ -72,7 +72,10 @@ bool Nyms::Exists(const std::string& id) const
 {
     Lock lock(write_lock_);
 
-    return nyms_.find(id) != nyms_.end();
+    // Nym nodes are instantiated on demand, so a nym which has not been
+    // accessed since the tree was loaded is only present in the index
+    return (nyms_.find(id) != nyms_.end()) ||
+           (item_map_.find(id) != item_map_.end());
 }
 
 void Nyms::init(const std::string& hash)
@@ -93,10 +96,7 @@ void Nyms::init(const std::string& hash)
         version_ = 2;
     }
 
-    for (const auto& it : serialized->nym()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_list(*serialized);
 }
 
 void Nyms::Map(NymLambda lambda) const
@@ -133,6 +133,7 @@ bool Nyms::Migrate(const opentxs::api::storage::Driver& to) const
     }
 
     output &= migrate(root_, to);
+    output &= migrate_chunks(to);
 
     return output;
 }
@@ -217,13 +218,7 @@ bool Nyms::save(const Lock& lock) const
         abort();
     }
 
-    auto serialized = serialize();
-
-    if (!proto::Validate(serialized, VERBOSE)) {
-        return false;
-    }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_list(lock);
 }
 
 void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
@@ -238,34 +233,19 @@ void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
         abort();
     }
 
+    if (defer_save(*this, nym, id)) return;
+
     auto& index = item_map_[id];
     auto& hash = std::get<0>(index);
     auto& alias = std::get<1>(index);
     hash = nym->Root();
     alias = nym->Alias();
+    touch(id);
 
     if (!save(lock)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Save error" << std::endl;
         abort();
     }
 }
-
-proto::StorageNymList Nyms::serialize() const
-{
-    proto::StorageNymList serialized;
-    serialized.set_version(version_);
-
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
-    return serialized;
-}
 }  // namespace storage
 }  // namespace opentxs
@@ -236,6 +236,8 @@ void Root::save(class Tree* tree, const Lock& lock)
 
     OT_ASSERT(nullptr != tree);
 
+    if (defer_save(*this, tree)) return;
+
     Lock treeLock(tree_lock_);
     tree_root_ = tree->Root();
     tree_lock_.unlock();
@@ -203,7 +203,7 @@ bool Seeds::Store(const proto::Seed& data, const std::string& alias)
         std::get<1>(metadata) = alias;
     }
 
-    return save(lock);
+    return commit(lock);
 }
 }  // namespace storage
 }  // namespace opentxs
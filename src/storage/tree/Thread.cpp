@@ -134,6 +134,9 @@ bool Thread::Add(
     }
 
     auto& item = items_[id];
+
+    if (item.unread()) --unread_;
+
     item.set_version(version_);
     item.set_id(id);
 
@@ -156,7 +159,9 @@ bool Thread::Add(
         return false;
     }
 
-    return save(lock);
+    if (unread) ++unread_;
+
+    return commit(lock);
 }
 
 std::string Thread::Alias() const
@@ -191,6 +196,8 @@ void Thread::init(const std::string& hash)
         const auto& index = it.index();
         items_.emplace(it.id(), it);
 
+        if (it.unread()) ++unread_;
+
         if (index >= index_) {
             index_ = index + 1;
         }
@@ -236,6 +243,14 @@ bool Thread::Read(const std::string& id, const bool unread)
 
     auto& item = it->second;
 
+    if (item.unread() != unread) {
+        if (unread) {
+            ++unread_;
+        } else {
+            --unread_;
+        }
+    }
+
     item.set_unread(unread);
 
     return save(lock);
@@ -253,6 +268,9 @@ bool Thread::Remove(const std::string& id)
 
     auto& item = it->second;
     StorageBox box = static_cast<StorageBox>(item.box());
+
+    if (item.unread()) --unread_;
+
     items_.erase(it);
 
     switch (box) {
@@ -355,17 +373,8 @@ Thread::SortedItems Thread::sort(const Lock& lock) const
 std::size_t Thread::UnreadCount() const
 {
     Lock lock(write_lock_);
-    std::size_t output{0};
-
-    for (const auto& it : items_) {
-        const auto& item = it.second;
 
-        if (item.unread()) {
-            ++output;
-        }
-    }
-
-    return output;
+    return unread_;
 }
 
 void Thread::upgrade(const Lock& lock)
@@ -383,6 +392,7 @@ void Thread::upgrade(const Lock& lock)
             case StorageBox::OUTGOINGBLOCKCHAIN: {
                 if (item.unread()) {
                     item.set_unread(false);
+                    --unread_;
                     changed = true;
                 }
             } break;
@@ -97,6 +97,7 @@ std::string Threads::create(
         Lock threadLock(newThread->write_lock_);
         newThread->save(threadLock);
         node.swap(newThread);
+        set_unread(lock, id, 0);
         save(lock);
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Thread already exists."
@@ -115,6 +116,21 @@ std::string Threads::Create(
     return create(lock, id, participants);
 }
 
+void Threads::count_all(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    // Every counted thread is in item_map_, so equal sizes mean none are
+    // missing
+    if (unread_.size() == item_map_.size()) return;
+
+    for (const auto& it : item_map_) {
+        const auto& id = it.first;
+
+        if (0 == unread_.count(id)) thread(id, lock);
+    }
+}
+
 bool Threads::Exists(const std::string& id) const
 {
     std::unique_lock<std::mutex> lock(write_lock_);
@@ -135,6 +151,7 @@ bool Threads::FindAndDeleteItem(const std::string& itemID)
 
         if (hasItem) {
             node.Remove(itemID);
+            set_unread(lock, id, node.UnreadCount());
             found = true;
         }
     }
@@ -164,10 +181,7 @@ void Threads::init(const std::string& hash)
         version_ = 2;
     }
 
-    for (const auto& it : serialized->nym()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_list(*serialized);
 }
 
 ObjectList Threads::List(const bool unreadOnly) const
@@ -179,15 +193,13 @@ ObjectList Threads::List(const bool unreadOnly) const
 
     ObjectList output{};
     Lock lock(write_lock_);
+    count_all(lock);
 
     for (const auto& it : item_map_) {
         const auto& threadID = it.first;
         const auto& alias = std::get<1>(it.second);
-        auto thread = Threads::thread(threadID, lock);
 
-        OT_ASSERT(nullptr != thread);
-
-        if (0 < thread->UnreadCount()) {
+        if (0 < unread_.at(threadID)) {
             output.push_back({threadID, alias});
         }
     }
@@ -206,6 +218,7 @@ bool Threads::Migrate(const opentxs::api::storage::Driver& to) const
     }
 
     output &= migrate(root_, to);
+    output &= migrate_chunks(to);
 
     return output;
 }
@@ -220,6 +233,19 @@ Editor<class Thread> Threads::mutable_Thread(const std::string& id)
     return Editor<class Thread>(write_lock_, thread(id), callback);
 }
 
+void Threads::set_unread(
+    const Lock& lock,
+    const std::string& id,
+    const std::size_t count) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& existing = unread_[id];
+    unread_total_ -= existing;
+    existing = count;
+    unread_total_ += count;
+}
+
 class Thread* Threads::thread(const std::string& id) const
 {
     std::unique_lock<std::mutex> lock(write_lock_);
@@ -250,6 +276,8 @@ class Thread* Threads::thread(
                       << std::endl;
             abort();
         }
+
+        set_unread(lock, id, node->UnreadCount());
     }
 
     return node.get();
@@ -298,11 +326,18 @@ bool Threads::Rename(const std::string& existingID, const std::string& newID)
     }
 
     newThread.reset(oldThread.release());
+    std::get<0>(meta) = newThread->Root();
     threads_.erase(threadItem);
     threads_.emplace(
         newID, std::unique_ptr<opentxs::storage::Thread>(newThread.release()));
     item_map_.erase(it);
     item_map_.emplace(newID, meta);
+    const auto unread = unread_[existingID];
+    set_unread(lock, existingID, 0);
+    unread_.erase(existingID);
+    set_unread(lock, newID, unread);
+    touch(existingID);
+    touch(newID);
 
     return save(lock);
 }
@@ -314,14 +349,7 @@ bool Threads::save(const std::unique_lock<std::mutex>& lock) const
         abort();
     }
 
-    auto serialized = serialize();
-
-    if (!proto::Validate(serialized, VERBOSE)) {
-
-        return false;
-    }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_list(lock);
 }
 
 void Threads::save(
@@ -339,11 +367,20 @@ void Threads::save(
         abort();
     }
 
+    // The thread was renamed after this update was deferred, and Rename
+    // recorded it under the new id
+    if (0 == threads_.count(id)) return;
+
+    set_unread(lock, id, nym->UnreadCount());
+
+    if (defer_save(*this, nym, id)) return;
+
     auto& index = item_map_[id];
     auto& hash = std::get<0>(index);
     auto& alias = std::get<1>(index);
     hash = nym->Root();
     alias = nym->Alias();
+    touch(id);
 
     if (!save(lock)) {
         std::cerr << __FUNCTION__ << ": Save error" << std::endl;
@@ -351,22 +388,12 @@ void Threads::save(
     }
 }
 
-proto::StorageNymList Threads::serialize() const
+std::size_t Threads::UnreadCount() const
 {
-    proto::StorageNymList serialized;
-    serialized.set_version(version_);
-
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
+    Lock lock(write_lock_);
+    count_all(lock);
 
-    return serialized;
+    return unread_total_;
 }
 }  // namespace storage
 }  // namespace opentxs
@@ -350,6 +350,8 @@ void Tree::save(BlockchainTransactions* blockchain, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, blockchain)) return;
+
     Lock mapLock(blockchain_lock_);
     blockchain_root_ = blockchain->Root();
     mapLock.unlock();
@@ -372,6 +374,8 @@ void Tree::save(Contacts* contacts, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, contacts)) return;
+
     Lock mapLock(contact_lock_);
     contact_root_ = contacts->Root();
     mapLock.unlock();
@@ -394,6 +398,8 @@ void Tree::save(Credentials* credentials, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, credentials)) return;
+
     Lock mapLock(credential_lock_);
     credential_root_ = credentials->Root();
     mapLock.unlock();
@@ -416,6 +422,8 @@ void Tree::save(Nyms* nyms, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, nyms)) return;
+
     Lock mapLock(nym_lock_);
     nym_root_ = nyms->Root();
     mapLock.unlock();
@@ -438,6 +446,8 @@ void Tree::save(Seeds* seeds, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, seeds)) return;
+
     Lock mapLock(seed_lock_);
     seed_root_ = seeds->Root();
     mapLock.unlock();
@@ -460,6 +470,8 @@ void Tree::save(Servers* servers, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, servers)) return;
+
     Lock mapLock(server_lock_);
     server_root_ = servers->Root();
     mapLock.unlock();
@@ -482,6 +494,8 @@ void Tree::save(Units* units, const Lock& lock)
         abort();
     }
 
+    if (defer_save(*this, units)) return;
+
     Lock mapLock(unit_lock_);
     unit_root_ = units->Root();
     mapLock.unlock();
@@ -0,0 +1,121 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/api/client/Wallet.hpp"
+#include "opentxs/api/Api.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/client/OTAPI_Exec.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Nym.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+#if OT_CRYPTO_SUPPORTED_KEY_HD
+const std::size_t nym_count_{10};
+
+std::uint32_t nym_index(const std::string& id)
+{
+    const auto nym = OT::App().Wallet().Nym(Identifier(id));
+
+    EXPECT_TRUE(nym);
+
+    if (false == bool(nym)) { return 0; }
+
+    proto::HDPath path;
+
+    EXPECT_TRUE(nym->Path(path));
+    EXPECT_LE(2, path.child_size());
+
+    if (2 > path.child_size()) { return 0; }
+
+    return path.child(1) & ~static_cast<std::uint32_t>(Bip32Child::HARDENED);
+}
+
+// Each nym created in bulk takes the next nym index from the seed.
+TEST(Test_CreateNymsHD, bulk_nyms_take_sequential_indices)
+{
+    std::vector<std::string> names{};
+
+    for (std::size_t i = 0; i < nym_count_; ++i) {
+        names.emplace_back("bulk nym " + std::to_string(i));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto ids = OT::App().API().Exec().CreateNymsHD(
+        proto::CITEMTYPE_INDIVIDUAL, names);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(names.size(), ids.size());
+
+    const std::set<std::string> unique(ids.begin(), ids.end());
+
+    EXPECT_EQ(ids.size(), unique.size());
+
+    std::vector<std::uint32_t> indices{};
+
+    for (const auto& id : ids) {
+        ASSERT_FALSE(id.empty());
+
+        indices.emplace_back(nym_index(id));
+    }
+
+    for (std::size_t i = 1; i < indices.size(); ++i) {
+        EXPECT_EQ(indices[i - 1] + 1, indices[i]);
+    }
+
+    if (0 < elapsed.count()) {
+        RecordProperty(
+            "nyms_per_second",
+            std::to_string(static_cast<double>(ids.size()) / elapsed.count()));
+    }
+}
+#endif  // OT_CRYPTO_SUPPORTED_KEY_HD
+}  // namespace
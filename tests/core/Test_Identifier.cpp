@@ -0,0 +1,140 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstring>
+#include <map>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+Identifier make_id(const char* seed, const ID type = ID::BLAKE2B)
+{
+    Identifier output;
+    output.CalculateDigest(String(seed), type);
+
+    return output;
+}
+
+TEST(Test_Identifier, equal_after_round_trip)
+{
+    const auto id = make_id("one");
+    const Identifier copy(String(id));
+
+    EXPECT_TRUE(id == copy);
+    EXPECT_FALSE(id != copy);
+    EXPECT_FALSE(id < copy);
+    EXPECT_FALSE(copy < id);
+}
+
+TEST(Test_Identifier, different_digests_differ)
+{
+    const auto one = make_id("one");
+    const auto two = make_id("two");
+
+    EXPECT_FALSE(one == two);
+    EXPECT_TRUE(one != two);
+    EXPECT_NE(one < two, two < one);
+}
+
+TEST(Test_Identifier, empty_identifiers_are_equal)
+{
+    const Identifier one;
+    const Identifier two;
+
+    EXPECT_TRUE(one == two);
+    EXPECT_FALSE(one < two);
+    EXPECT_FALSE(two < one);
+}
+
+TEST(Test_Identifier, empty_sorts_first)
+{
+    const Identifier empty;
+    const auto id = make_id("one");
+
+    EXPECT_TRUE(empty < id);
+    EXPECT_FALSE(id < empty);
+    EXPECT_TRUE(id > empty);
+}
+
+// Ordering is by hash type first, then by the binary digest, rather than by
+// the base58 string form.
+TEST(Test_Identifier, ordered_by_type_then_digest)
+{
+    const auto sha = make_id("one", ID::SHA256);
+    const auto blake = make_id("one", ID::BLAKE2B);
+
+    ASSERT_EQ(ID::SHA256, sha.Type());
+    ASSERT_EQ(ID::BLAKE2B, blake.Type());
+    EXPECT_TRUE(sha < blake);
+    EXPECT_FALSE(sha == blake);
+
+    const auto one = make_id("one");
+    const auto two = make_id("two");
+
+    ASSERT_EQ(one.GetSize(), two.GetSize());
+
+    const bool expected =
+        0 > std::memcmp(one.GetPointer(), two.GetPointer(), one.GetSize());
+
+    EXPECT_EQ(expected, one < two);
+    EXPECT_EQ(!expected, two < one);
+    EXPECT_EQ(expected, one <= two);
+    EXPECT_EQ(!expected, one >= two);
+}
+
+TEST(Test_Identifier, map_lookup)
+{
+    std::map<Identifier, std::string> map{};
+    map.emplace(make_id("one"), "one");
+    map.emplace(make_id("two"), "two");
+    map.emplace(make_id("one", ID::SHA256), "sha");
+
+    ASSERT_EQ(3u, map.size());
+    EXPECT_EQ("one", map.at(Identifier(String(make_id("one")))));
+    EXPECT_EQ("two", map.at(make_id("two")));
+    EXPECT_EQ("sha", map.at(make_id("one", ID::SHA256)));
+}
+}  // namespace
@@ -0,0 +1,144 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/Contract.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Ledger.hpp"
+#include "opentxs/core/OTTransaction.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstdint>
+
+using namespace opentxs;
+
+namespace
+{
+Identifier make_id(const char* seed)
+{
+    Identifier output;
+    output.CalculateDigest(String(seed));
+
+    return output;
+}
+
+OTTransaction* make_receipt(
+    Ledger& box,
+    const std::int64_t number,
+    const std::int64_t reference)
+{
+    auto* receipt = OTTransaction::GenerateTransaction(
+        box, OTTransaction::chequeReceipt, originType::not_applicable, number);
+
+    OT_ASSERT(nullptr != receipt);
+
+    receipt->SetReferenceToNum(reference);
+    static_cast<Contract*>(receipt)->SaveContract();
+
+    return receipt;
+}
+
+// The inbox hash is exchanged between client and server, so it must follow
+// the contents of the receipts and not only their transaction numbers.
+TEST(Test_Ledger, inbox_hash_covers_contents)
+{
+    const auto nymID = make_id("nym");
+    const auto notaryID = make_id("notary");
+    const auto firstAccount = make_id("first account");
+    const auto secondAccount = make_id("second account");
+    Ledger first(nymID, firstAccount, notaryID);
+    Ledger second(nymID, secondAccount, notaryID);
+
+    ASSERT_TRUE(first.GenerateLedger(firstAccount, notaryID, Ledger::inbox));
+    ASSERT_TRUE(second.GenerateLedger(secondAccount, notaryID, Ledger::inbox));
+
+    Identifier empty, other;
+
+    ASSERT_TRUE(first.CalculateInboxHash(empty));
+    ASSERT_TRUE(second.CalculateInboxHash(other));
+    EXPECT_FALSE(empty == other);
+
+    auto* receipt = make_receipt(first, 100, 1);
+
+    ASSERT_TRUE(first.AddTransaction(*receipt));
+
+    Identifier original;
+
+    ASSERT_TRUE(first.CalculateInboxHash(original));
+    EXPECT_FALSE(empty == original);
+
+    receipt->SetReferenceToNum(2);
+    static_cast<Contract*>(receipt)->SaveContract();
+    Identifier changed;
+
+    ASSERT_TRUE(first.CalculateInboxHash(changed));
+    EXPECT_FALSE(original == changed);
+
+    auto* another = make_receipt(first, 101, 3);
+
+    ASSERT_TRUE(first.AddTransaction(*another));
+
+    Identifier both;
+
+    ASSERT_TRUE(first.CalculateInboxHash(both));
+    EXPECT_FALSE(changed == both);
+
+    // The hash does not depend on the order receipts were added in.
+    ASSERT_TRUE(first.RemoveTransaction(100, false));
+    ASSERT_TRUE(first.AddTransaction(*receipt));
+
+    Identifier reordered;
+
+    ASSERT_TRUE(first.CalculateInboxHash(reordered));
+    EXPECT_TRUE(both == reordered);
+
+    // Removing receipts restores the earlier hashes.
+    ASSERT_TRUE(first.RemoveTransaction(101));
+
+    Identifier removed;
+
+    ASSERT_TRUE(first.CalculateInboxHash(removed));
+    EXPECT_TRUE(changed == removed);
+    ASSERT_TRUE(first.RemoveTransaction(100));
+    ASSERT_TRUE(first.CalculateInboxHash(removed));
+    EXPECT_TRUE(empty == removed);
+}
+}  // namespace
@@ -0,0 +1,172 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/core/crypto/Libsodium.hpp"
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstring>
+#include <memory>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_Message : public ::testing::Test
+{
+public:
+    const Libsodium& engine_;
+    OTPassword clientPrivate_;
+    OTPassword serverPrivate_;
+    OTData clientPublic_;
+    OTData serverPublic_;
+
+    Test_Message()
+        : engine_(static_cast<const Libsodium&>(OT::App().Crypto().ED25519()))
+        , clientPrivate_()
+        , serverPrivate_()
+        , clientPublic_(Data::Factory())
+        , serverPublic_(Data::Factory())
+    {
+        engine_.RandomKeypair(clientPrivate_, clientPublic_);
+        engine_.RandomKeypair(serverPrivate_, serverPublic_);
+    }
+
+    std::unique_ptr<Message> request(const OTPassword& key, const String& id)
+    {
+        std::unique_ptr<Message> output(new Message);
+        output->m_strCommand = Message::Command(MessageType::getNymbox).c_str();
+        output->m_strNymID = "nym";
+        output->m_strNotaryID = "notary";
+        output->m_strRequestNum = "100";
+
+        EXPECT_TRUE(output->SignSession(id, key));
+        EXPECT_TRUE(output->SaveContract());
+
+        return output;
+    }
+};
+
+bool same_key(const OTPassword& lhs, const OTPassword& rhs)
+{
+    return (lhs.getMemorySize() == rhs.getMemorySize()) &&
+           (0 == std::memcmp(
+                     lhs.getMemory(), rhs.getMemory(), lhs.getMemorySize()));
+}
+
+TEST_F(Test_Message, both_sides_derive_the_same_session)
+{
+    OTPassword clientRequestKey, clientReplyKey, serverRequestKey,
+        serverReplyKey;
+    String clientID, serverID;
+
+    ASSERT_TRUE(Message::DeriveSessionKey(
+        clientPrivate_,
+        serverPublic_,
+        clientPublic_,
+        serverPublic_,
+        clientRequestKey,
+        clientReplyKey,
+        clientID));
+    ASSERT_TRUE(Message::DeriveSessionKey(
+        serverPrivate_,
+        clientPublic_,
+        clientPublic_,
+        serverPublic_,
+        serverRequestKey,
+        serverReplyKey,
+        serverID));
+
+    EXPECT_TRUE(same_key(clientRequestKey, serverRequestKey));
+    EXPECT_TRUE(same_key(clientReplyKey, serverReplyKey));
+    EXPECT_FALSE(same_key(clientRequestKey, clientReplyKey));
+    EXPECT_TRUE(clientID.Compare(serverID));
+}
+
+TEST_F(Test_Message, session_mac_survives_serialization)
+{
+    OTPassword requestKey, replyKey, otherRequestKey, otherReplyKey;
+    String id, otherID;
+
+    ASSERT_TRUE(Message::DeriveSessionKey(
+        clientPrivate_,
+        serverPublic_,
+        clientPublic_,
+        serverPublic_,
+        requestKey,
+        replyKey,
+        id));
+    ASSERT_TRUE(Message::DeriveSessionKey(
+        serverPrivate_,
+        clientPublic_,
+        serverPublic_,
+        clientPublic_,
+        otherRequestKey,
+        otherReplyKey,
+        otherID));
+
+    const auto sent = request(requestKey, id);
+    Message received;
+
+    ASSERT_TRUE(received.LoadContractFromString(String(*sent)));
+    EXPECT_TRUE(received.m_strSessionID.Compare(id));
+    EXPECT_TRUE(received.VerifySession(id, requestKey));
+    EXPECT_FALSE(received.VerifySession(id, otherRequestKey));
+    EXPECT_FALSE(received.VerifySession(otherID, requestKey));
+    // A request MAC is not valid in the other direction.
+    EXPECT_FALSE(received.VerifySession(id, replyKey));
+}
+
+TEST_F(Test_Message, transactions_stay_signed)
+{
+    EXPECT_TRUE(Message::SessionEligible(MessageType::getRequestNumber));
+    EXPECT_TRUE(Message::SessionEligible(MessageType::getNymboxR));
+    EXPECT_FALSE(Message::SessionEligible(MessageType::notarizeTransaction));
+    EXPECT_FALSE(Message::SessionEligible(MessageType::processInbox));
+    EXPECT_FALSE(Message::SessionEligible(MessageType::processNymbox));
+    EXPECT_FALSE(Message::SessionEligible(MessageType::sendNymMessage));
+}
+}  // namespace
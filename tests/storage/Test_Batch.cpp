@@ -0,0 +1,115 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/api/Api.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/client/OTAPI_Exec.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace
+{
+const std::size_t thread_count_{100};
+
+int per_second(
+    const std::size_t count,
+    const std::chrono::steady_clock::duration elapsed)
+{
+    const auto ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+
+    return static_cast<int>((1000 * count) / ((0 < ms) ? ms : 1));
+}
+
+bool create_threads(const std::string& nymID, const std::string& prefix)
+{
+    const auto& storage = opentxs::OT::App().DB();
+
+    for (std::size_t i = 0; i < thread_count_; ++i) {
+        const auto threadID = prefix + std::to_string(i);
+
+        if (false == storage.CreateThread(nymID, threadID, {threadID})) {
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(Test_Batch, batched_writes_survive_reload)
+{
+    const auto nymID = opentxs::OT::App().API().Exec().CreateNymHD(
+        opentxs::proto::CITEMTYPE_INDIVIDUAL, "batch test");
+
+    ASSERT_FALSE(nymID.empty());
+
+    const auto& storage = opentxs::OT::App().DB();
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        const opentxs::api::storage::Batch batch(storage);
+
+        ASSERT_TRUE(create_threads(nymID, "batched"));
+    }
+
+    const auto batched = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+
+    ASSERT_TRUE(create_threads(nymID, "unbatched"));
+
+    const auto unbatched = std::chrono::steady_clock::now() - start;
+    RecordProperty(
+        "batched_threads_per_second", per_second(thread_count_, batched));
+    RecordProperty(
+        "unbatched_threads_per_second", per_second(thread_count_, unbatched));
+
+    opentxs::OT::Cleanup();
+    opentxs::ArgList args;
+    opentxs::OT::ClientFactory(args);
+    const auto threads = opentxs::OT::App().DB().ThreadList(nymID, false);
+
+    EXPECT_EQ(2 * thread_count_, threads.size());
+}
+}  // namespace
@@ -0,0 +1,212 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/api/Api.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/client/OTAPI_Exec.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+
+#include <set>
+#include <string>
+
+namespace
+{
+const std::string thread_id_{"storageTestThread"};
+const std::string item_id_{"storageTestItem"};
+const std::string other_thread_id_{"storageTestOtherThread"};
+
+// Creates a nym with two threads: thread_id_ holds two unread items and
+// other_thread_id_ holds one.
+std::string create_threads()
+{
+    const auto nymID = opentxs::OT::App().API().Exec().CreateNymHD(
+        opentxs::proto::CITEMTYPE_INDIVIDUAL, "unread test");
+
+    EXPECT_FALSE(nymID.empty());
+
+    const auto& storage = opentxs::OT::App().DB();
+    const auto store = [&](const std::string& thread, const std::string& item) {
+        EXPECT_TRUE(storage.Store(
+            nymID,
+            thread,
+            item,
+            1,
+            "",
+            "message",
+            opentxs::StorageBox::MAILINBOX));
+    };
+
+    EXPECT_TRUE(storage.CreateThread(nymID, thread_id_, {thread_id_}));
+    EXPECT_TRUE(
+        storage.CreateThread(nymID, other_thread_id_, {other_thread_id_}));
+    store(thread_id_, item_id_ + "1");
+    store(thread_id_, item_id_ + "2");
+    store(other_thread_id_, item_id_ + "3");
+
+    return nymID;
+}
+
+std::set<std::string> unread_threads(const std::string& nymID)
+{
+    std::set<std::string> output{};
+
+    for (const auto& it : opentxs::OT::App().DB().ThreadList(nymID, true)) {
+        output.emplace(it.first);
+    }
+
+    return output;
+}
+
+void reload()
+{
+    opentxs::OT::Cleanup();
+    opentxs::ArgList args;
+    opentxs::OT::ClientFactory(args);
+}
+
+TEST(Test_Threads, thread_survives_reload)
+{
+    const auto nymID = opentxs::OT::App().API().Exec().CreateNymHD(
+        opentxs::proto::CITEMTYPE_INDIVIDUAL, "storage test");
+
+    ASSERT_FALSE(nymID.empty());
+
+    const auto& storage = opentxs::OT::App().DB();
+
+    ASSERT_TRUE(storage.CreateThread(nymID, thread_id_, {thread_id_}));
+    ASSERT_TRUE(storage.Store(
+        nymID,
+        thread_id_,
+        item_id_,
+        1,
+        "",
+        "message",
+        opentxs::StorageBox::MAILINBOX));
+    ASSERT_TRUE(storage.ThreadExists(nymID, thread_id_));
+
+    // Reopen storage so the nym is only present in the index
+    reload();
+    const auto& reloaded = opentxs::OT::App().DB();
+
+    EXPECT_TRUE(reloaded.ThreadExists(nymID, thread_id_));
+    EXPECT_EQ(1u, reloaded.UnreadCount(nymID, thread_id_));
+
+    std::shared_ptr<opentxs::proto::StorageThread> thread;
+
+    ASSERT_TRUE(reloaded.Load(nymID, thread_id_, thread));
+    ASSERT_TRUE(thread);
+    ASSERT_EQ(1, thread->item_size());
+    EXPECT_EQ(item_id_, thread->item(0).id());
+}
+
+TEST(Test_Threads, unread_counts_follow_read_state)
+{
+    const auto nymID = create_threads();
+    const auto& storage = opentxs::OT::App().DB();
+
+    EXPECT_EQ(3u, storage.UnreadCount(nymID));
+    EXPECT_EQ(2u, storage.UnreadCount(nymID, thread_id_));
+    EXPECT_EQ(
+        std::set<std::string>({thread_id_, other_thread_id_}),
+        unread_threads(nymID));
+
+    ASSERT_TRUE(
+        storage.SetReadState(nymID, thread_id_, item_id_ + "1", false));
+
+    EXPECT_EQ(2u, storage.UnreadCount(nymID));
+    EXPECT_EQ(1u, storage.UnreadCount(nymID, thread_id_));
+
+    ASSERT_TRUE(
+        storage.SetReadState(nymID, other_thread_id_, item_id_ + "3", false));
+
+    EXPECT_EQ(1u, storage.UnreadCount(nymID));
+    EXPECT_EQ(std::set<std::string>({thread_id_}), unread_threads(nymID));
+
+    // Marking an item unread again counts it again
+    ASSERT_TRUE(
+        storage.SetReadState(nymID, other_thread_id_, item_id_ + "3", true));
+
+    EXPECT_EQ(2u, storage.UnreadCount(nymID));
+    EXPECT_EQ(
+        std::set<std::string>({thread_id_, other_thread_id_}),
+        unread_threads(nymID));
+}
+
+TEST(Test_Threads, unread_counts_follow_removal)
+{
+    const auto nymID = create_threads();
+    const auto& storage = opentxs::OT::App().DB();
+
+    ASSERT_TRUE(storage.RemoveNymBoxItem(
+        nymID, opentxs::StorageBox::MAILINBOX, item_id_ + "3"));
+
+    EXPECT_EQ(2u, storage.UnreadCount(nymID));
+    EXPECT_EQ(0u, storage.UnreadCount(nymID, other_thread_id_));
+    EXPECT_EQ(std::set<std::string>({thread_id_}), unread_threads(nymID));
+
+    ASSERT_TRUE(storage.RemoveNymBoxItem(
+        nymID, opentxs::StorageBox::MAILINBOX, item_id_ + "1"));
+    ASSERT_TRUE(storage.RemoveNymBoxItem(
+        nymID, opentxs::StorageBox::MAILINBOX, item_id_ + "2"));
+
+    EXPECT_EQ(0u, storage.UnreadCount(nymID));
+    EXPECT_TRUE(unread_threads(nymID).empty());
+}
+
+TEST(Test_Threads, unread_counts_survive_reload)
+{
+    const auto nymID = create_threads();
+
+    ASSERT_TRUE(opentxs::OT::App().DB().SetReadState(
+        nymID, thread_id_, item_id_ + "1", false));
+    ASSERT_TRUE(opentxs::OT::App().DB().RemoveNymBoxItem(
+        nymID, opentxs::StorageBox::MAILINBOX, item_id_ + "3"));
+
+    reload();
+    const auto& storage = opentxs::OT::App().DB();
+
+    EXPECT_EQ(1u, storage.UnreadCount(nymID));
+    EXPECT_EQ(1u, storage.UnreadCount(nymID, thread_id_));
+    EXPECT_EQ(0u, storage.UnreadCount(nymID, other_thread_id_));
+    EXPECT_EQ(std::set<std::string>({thread_id_}), unread_threads(nymID));
+}
+}  // namespace
@@ -71,6 +71,7 @@ intmax_t imaxabs(intmax_t j) {
 namespace std {
    %template(VectorUnsignedChar) vector<unsigned char>;
    %template(MapStringString) map<string,string>;
+   %template(VectorString) vector<string>;
 };
 
 %ignore OTRecord::operator<(const OTRecord & rhs);